@@ -27,6 +27,7 @@ module system (
 	input reset /*verilator public_flat*/,
 	input [11:0] inputs,
 	output [23:0] rgb,
+	output [3:0] col,
 	output vsync,
 	output hsync,
 	output vblank,
@@ -66,16 +67,16 @@ wire rom_read/*verilator public_flat*/;
 assign rom_read = rom_cs & ~cpu_rd_n;
 // CPU RAM
 wire ram_cs = cpu_addr >= 16'hE000 && ~cpu_mreq_n;
-wire ram_read = ram_cs & ~cpu_rd_n;
-wire ram_write = ram_cs & ~cpu_wr_n;
+wire ram_read /*verilator public_flat*/ = ram_cs & ~cpu_rd_n;
+wire ram_write /*verilator public_flat*/ = ram_cs & ~cpu_wr_n;
 // Z80 PIO
 wire pio_cs = ~cpu_addr[7] && ~cpu_iorq_n;
-wire pio_read = pio_cs & ~cpu_rd_n;
-wire pio_write = pio_cs & ~cpu_wr_n;
+wire pio_read /*verilator public_flat*/ = pio_cs & ~cpu_rd_n;
+wire pio_write /*verilator public_flat*/ = pio_cs & ~cpu_wr_n;
 // VDP
 wire vdp_cs = cpu_addr[7] && ~cpu_iorq_n;
-wire vdp_read = vdp_cs & ~cpu_rd_n;
-wire vdp_write = vdp_cs & ~cpu_wr_n;
+wire vdp_read /*verilator public_flat*/ = vdp_cs & ~cpu_rd_n;
+wire vdp_write /*verilator public_flat*/ = vdp_cs & ~cpu_wr_n;
 // Memory card/cartridge
 wire cartridge_cs = cpu_addr >= 16'h4000 && cpu_addr < 16'hC000;
 wire cartridge_read = cartridge_cs & ~cpu_rd_n;
@@ -116,11 +117,11 @@ dpram #(14,8,"roms/bios.hex") pgrom
 );
 
 // IC5 - Z80 CPU
-wire cpu_mreq_n;
+wire cpu_mreq_n /*verilator public_flat*/;
 wire cpu_iorq_n;
 wire cpu_rd_n;
 wire cpu_wr_n;
-wire cpu_m1_n;
+wire cpu_m1_n /*verilator public_flat*/;
 wire [15:0] cpu_addr;
 wire [7:0] cpu_data_in;
 wire [7:0] cpu_data_out;
@@ -204,6 +205,7 @@ end
 wire vdp_int_n;
 wire [7:0] vdp_data_out;
 wire [3:0] vdp_col;
+wire [3:0] vdp_col_q;
 wire [7:0] vdp_r;
 wire [7:0] vdp_g;
 wire [7:0] vdp_b;
@@ -213,7 +215,7 @@ wire vdp_csync_n;
 wire vdp_blank_n;
 wire vdp_hblank;
 wire vdp_vblank;
-wire vdp_cpu_clk;
+wire vdp_cpu_clk /*verilator public_flat*/;
 vdp18_core #(
 	.is_pal_g(1'b1),
 	.compat_rgb_g(1'b0)
@@ -234,6 +236,7 @@ vdp18_core #(
 	.vram_d_i(vram_data_out),
 	.border_i(1'b1),
 	.col_o(vdp_col),
+	.col_q_o(vdp_col_q),
 	.rgb_r_o(vdp_r),
 	.rgb_g_o(vdp_g),
 	.rgb_b_o(vdp_b),
@@ -250,12 +253,13 @@ assign vsync = ~vdp_vsync_n;
 assign hblank = vdp_hblank;
 assign vblank = vdp_vblank;
 assign rgb = { vdp_b, vdp_g, vdp_r };
+assign col = vdp_col_q;
 
 // IC8/9 - VRAM
-wire [13:0] vram_addr;
+wire [13:0] vram_addr /*verilator public_flat*/;
 wire [7:0] vram_data_out;
 wire [7:0] vram_data_in;
-wire vram_we;
+wire vram_we /*verilator public_flat*/;
 spram #(14,8) vram 
 (
 	.clock(clk),
@@ -100,13 +100,15 @@ module tv80_core (/*AUTOARG*/
 
   // Registers
   reg [7:0]     ACC /*verilator public_flat*/;
-  reg [7:0]     F;
-  reg [7:0]     Ap, Fp;
+  reg [7:0]     F /*verilator public_flat*/;
+  reg [7:0]     Ap /*verilator public_flat*/;
+  reg [7:0]     Fp /*verilator public_flat*/;
   reg [7:0]     I /*verilator public_flat*/;
 `ifdef TV80_REFRESH
   reg [7:0]     R;
 `endif
-  reg [15:0]    SP, PC;
+  reg [15:0]    SP /*verilator public_flat*/;
+  reg [15:0]    PC /*verilator public_flat*/;
   reg [7:0]     RegDIH;
   reg [7:0]     RegDIL;
   wire [15:0]   RegBusA;
@@ -119,7 +121,7 @@ module tv80_core (/*AUTOARG*/
   reg [2:0]     RegAddrC;
   reg           RegWEH;
   reg           RegWEL;
-  reg           Alternate;
+  reg           Alternate /*verilator public_flat*/;
 
   // Help Registers
   reg [15:0]    TmpAddr;        // Temporary address register
@@ -175,8 +177,8 @@ module tv80_core (/*AUTOARG*/
   // Micro code outputs
   wire [2:0]    mcycles_d;
   wire [2:0]    tstates;
-  reg           IntCycle;
-  reg           NMICycle;
+  reg           IntCycle /*verilator public_flat*/;
+  reg           NMICycle /*verilator public_flat*/;
   wire          Inc_PC;
   wire          Inc_WZ;
   wire [3:0]    IncDec_16;
@@ -43,8 +43,8 @@ module tv80_reg (/*AUTOARG*/
     output [7:0] DOAH;
     input  clk, CEN, WEH, WEL;
 
-  reg [7:0] RegsH [0:7];
-  reg [7:0] RegsL [0:7];
+  reg [7:0] RegsH [0:7] /*verilator public_flat*/;
+  reg [7:0] RegsL [0:7] /*verilator public_flat*/;
 
   always @(posedge clk)
     begin
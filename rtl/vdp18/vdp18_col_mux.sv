@@ -73,6 +73,7 @@ module vdp18_col_mux
    input [0:3]        spr2_col_i,
    input [0:3]        spr3_col_i,
    output logic [0:3] col_o,
+   output logic [0:3] col_q_o,
    output logic [0:7] rgb_r_o,
    output logic [0:7] rgb_g_o,
    output logic [0:7] rgb_b_o
@@ -173,11 +174,14 @@ module vdp18_col_mux
           rgb_r_o <= '0;
           rgb_g_o <= '0;
           rgb_b_o <= '0;
+          col_q_o <= '0;
         end
         else
           begin
             if (clk_en_5m37_i)
               begin
+                // keep colour index aligned with RGB outputs
+                col_q_o <= col_o;
                 // select requested RGB table
                 if (compat_rgb_g)
                   begin
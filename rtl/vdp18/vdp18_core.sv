@@ -103,6 +103,7 @@ module vdp18_core
    // Video Interface --------------------------------------------------------
    input         border_i,
    output [0:3]  col_o,
+   output [0:3]  col_q_o,
    output [0:7]  rgb_r_o,
    output [0:7]  rgb_g_o,
    output [0:7]  rgb_b_o,
@@ -394,6 +395,7 @@ module vdp18_core
      .spr2_col_i(spr2_col_s),
      .spr3_col_i(spr3_col_s),
      .col_o(col_o),
+     .col_q_o(col_q_o),
      .blank_n_o(blank_n),
      .hblank_n_o(hblank_n),
      .vblank_n_o(vblank_n),
@@ -119,6 +119,9 @@ module vdp18_cpuio
   logic          wrvram_sched_q;
   logic          wrvram_q;
 
+  // CPU read-ahead from VRAM, watched by the sim harness
+  wire           vram_cpu_read_s /*verilator public_flat*/ = clk_en_acc_i && rdvram_q && (access_type_i == AC_CPU);
+
   logic          write_tmp_s;
   logic [0:7]    tmp_q;
   logic          write_reg_s;
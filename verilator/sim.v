@@ -28,6 +28,7 @@ module emu(
 	output [7:0] VGA_R/*verilator public_flat*/,
 	output [7:0] VGA_G/*verilator public_flat*/,
 	output [7:0] VGA_B/*verilator public_flat*/,
+	output [3:0] VGA_COL/*verilator public_flat*/,
 	
 	output VGA_HS,
 	output VGA_VS,
@@ -82,6 +83,7 @@ module emu(
 		.ce_vid(ce_vid),
 		.reset(reset),
 		.rgb(rgb),
+		.col(VGA_COL),
 		.inputs(~inputs),
 		.hsync(VGA_HS),
 		.vsync(VGA_VS),
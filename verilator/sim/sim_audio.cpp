@@ -1,34 +1,84 @@
 #include "sim_audio.h"
+#include "sim_wav.h"
+#include "sim_resampler.h"
+#include "sim_audio_ring.h"
 #include <iostream>
-#include <fstream>
 #include <list>
+#ifndef _MSC_VER
+#include <SDL.h>
+#else
+#define WIN32
+#endif
 using namespace std;
 
-SimClock clk;
+// Core output is box filtered over this many clk_sys cycles before resampling
+const int decimation = 64;
+int decimationCount;
+int32_t decimationSum_l;
+int32_t decimationSum_r;
+
+SimResampler* resampler = NULL;
+const int resampleChunk = 4096;
+int16_t resampleBuffer[resampleChunk * 2];
+
 bool outputToFile;
-ofstream audioFile;
+SimWavWriter audioFile;
 
-SimAudio::SimAudio(int systemClockFrequency, bool saveToFile)
+// Live playback, the sim thread produces into the ring and the SDL audio callback consumes
+SimAudioRing playbackRing(16384);
+bool playbackActive = false;
+#ifndef WIN32
+SDL_AudioDeviceID playbackDevice = 0;
+
+static void playbackCallback(void* userdata, Uint8* stream, int len)
 {
-	clk = SimClock(systemClockFrequency / 44100);
+	playbackRing.Read((int16_t*)stream, len / (2 * sizeof(int16_t)));
+}
+#endif
+
+SimAudio::SimAudio(int systemClockFrequency, bool saveToFile) : SimAudio(systemClockFrequency, 44100, saveToFile)
+{
+}
+
+SimAudio::SimAudio(int systemClockFrequency, int outputRate, bool saveToFile)
+{
+	output_rate = outputRate;
+	resampler = new SimResampler(systemClockFrequency, decimation, outputRate);
+	decimationCount = 0;
+	decimationSum_l = 0;
+	decimationSum_r = 0;
 	outputToFile = saveToFile;
 }
 
 SimAudio::~SimAudio()
 {
-
+	delete resampler;
+	resampler = NULL;
 }
 
 void SimAudio::Clock(signed short left, signed short right) {
-	clk.Tick();
-	if (clk.IsRising()) {
+	decimationSum_l += left;
+	decimationSum_r += right;
+	if (++decimationCount == decimation) {
+		resampler->Push((int16_t)(decimationSum_l / decimation), (int16_t)(decimationSum_r / decimation));
+		decimationCount = 0;
+		decimationSum_l = 0;
+		decimationSum_r = 0;
+	}
+}
+
+void SimAudio::Process() {
+	// Resample everything captured during the last simulation batch
+	int frames;
+	do {
+		frames = resampler->Process(resampleBuffer, resampleChunk);
+		if (playbackActive) { playbackRing.Write(resampleBuffer, frames); }
 		if (outputToFile) {
-			float l = left / 32768.0f;
-			float r = right / 32768.0f;
-			audioFile.write((const char*)&l, sizeof(float));
-			audioFile.write((const char*)&r, sizeof(float));
+			for (int i = 0; i < frames; i++) {
+				audioFile.Write(resampleBuffer[i * 2] / 32768.0f, resampleBuffer[i * 2 + 1] / 32768.0f);
+			}
 		}
-	}
+	} while (frames == resampleChunk);
 }
 
 void SimAudio::CollectDebug(signed short left, signed short right) {
@@ -51,13 +101,64 @@ void SimAudio::Initialise() {
 	if (outputToFile)
 	{
 		// Setup Audio output stream
-		audioFile.open("audio.wav", ios::binary);
+		audioFile.Open("audio.wav", output_rate, true);
 	}
 }
 void SimAudio::CleanUp() {
+	StopPlayback();
 	if (outputToFile)
 	{
-		audioFile.close();
+		audioFile.Close();
+	}
+}
+
+bool SimAudio::StartPlayback() {
+#ifndef WIN32
+	if (playbackActive) { return true; }
+	if (SDL_InitSubSystem(SDL_INIT_AUDIO) != 0) {
+		printf("Audio: %s\n", SDL_GetError());
+		return false;
 	}
+	SDL_AudioSpec want, have;
+	SDL_zero(want);
+	want.freq = output_rate;
+	want.format = AUDIO_S16SYS;
+	want.channels = 2;
+	want.samples = 1024;
+	want.callback = playbackCallback;
+	playbackDevice = SDL_OpenAudioDevice(NULL, 0, &want, &have, 0);
+	if (playbackDevice == 0) {
+		printf("Audio: %s\n", SDL_GetError());
+		return false;
+	}
+	playbackRing.Clear();
+	playbackActive = true;
+	SDL_PauseAudioDevice(playbackDevice, 0);
+	return true;
+#else
+	// Playback needs SDL, which the Windows build doesn't use
+	return false;
+#endif
+}
+
+void SimAudio::StopPlayback() {
+#ifndef WIN32
+	if (!playbackActive) { return; }
+	SDL_CloseAudioDevice(playbackDevice);
+	playbackDevice = 0;
+	playbackActive = false;
+#endif
+}
+
+float SimAudio::PlaybackFill() {
+	return playbackActive ? (float)playbackRing.Fill() / playbackRing.Capacity() : 0.0f;
+}
+
+uint32_t SimAudio::PlaybackUnderruns() {
+	return playbackRing.underruns.load(std::memory_order_relaxed);
+}
+
+uint32_t SimAudio::PlaybackOverruns() {
+	return playbackRing.overruns.load(std::memory_order_relaxed);
 }
 
@@ -1,12 +1,14 @@
 #pragma once
 
 #include <string>
+#include <stdint.h>
 #include "sim_clock.h"
 
 struct SimAudio {
 public:
 
 	SimClock clock;
+	int output_rate;
 	
 	static const unsigned short debug_max_samples = 600;
 	float debug_positions[debug_max_samples];
@@ -15,9 +17,16 @@ public:
 	int debug_pos;
 
 	SimAudio(int systemClockFrequency, bool saveToFile);
+	SimAudio(int systemClockFrequency, int outputRate, bool saveToFile);
 	~SimAudio();
 	void Clock(signed short left, signed short right);
+	void Process();
 	void CollectDebug(signed short left, signed short right);
 	void Initialise();
 	void CleanUp();
+	bool StartPlayback();
+	void StopPlayback();
+	float PlaybackFill();
+	uint32_t PlaybackUnderruns();
+	uint32_t PlaybackOverruns();
 };
@@ -0,0 +1,75 @@
+#include "sim_audio_ring.h"
+
+#include <string.h>
+
+SimAudioRing::SimAudioRing(uint32_t capacityFrames)
+{
+	capacity = 1;
+	while (capacity < capacityFrames) { capacity <<= 1; }
+	mask = capacity - 1;
+	buffer = new int16_t[capacity * 2];
+	Clear();
+}
+
+SimAudioRing::~SimAudioRing()
+{
+	delete[] buffer;
+}
+
+uint32_t SimAudioRing::Capacity()
+{
+	return capacity;
+}
+
+uint32_t SimAudioRing::Fill()
+{
+	return head.load(std::memory_order_acquire) - tail.load(std::memory_order_acquire);
+}
+
+uint32_t SimAudioRing::Write(const int16_t* frames, uint32_t count)
+{
+	// Indices run freely and wrap at 2^32, only the difference matters
+	uint32_t h = head.load(std::memory_order_relaxed);
+	uint32_t t = tail.load(std::memory_order_acquire);
+	uint32_t space = capacity - (h - t);
+	if (count > space) {
+		overruns.fetch_add(count - space, std::memory_order_relaxed);
+		count = space;
+	}
+
+	uint32_t start = h & mask;
+	uint32_t first = count < capacity - start ? count : capacity - start;
+	memcpy(&buffer[start * 2], frames, first * 2 * sizeof(int16_t));
+	memcpy(buffer, &frames[first * 2], (count - first) * 2 * sizeof(int16_t));
+	head.store(h + count, std::memory_order_release);
+	return count;
+}
+
+uint32_t SimAudioRing::Read(int16_t* frames, uint32_t count)
+{
+	uint32_t t = tail.load(std::memory_order_relaxed);
+	uint32_t h = head.load(std::memory_order_acquire);
+	uint32_t available = h - t;
+	uint32_t read = count < available ? count : available;
+
+	uint32_t start = t & mask;
+	uint32_t first = read < capacity - start ? read : capacity - start;
+	memcpy(frames, &buffer[start * 2], first * 2 * sizeof(int16_t));
+	memcpy(&frames[first * 2], buffer, (read - first) * 2 * sizeof(int16_t));
+	tail.store(t + read, std::memory_order_release);
+
+	if (read < count) {
+		memset(&frames[read * 2], 0, (count - read) * 2 * sizeof(int16_t));
+		underruns.fetch_add(count - read, std::memory_order_relaxed);
+	}
+	return read;
+}
+
+void SimAudioRing::Clear()
+{
+	// Only safe while the consumer is stopped
+	head.store(0);
+	tail.store(0);
+	underruns.store(0);
+	overruns.store(0);
+}
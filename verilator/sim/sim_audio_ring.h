@@ -0,0 +1,29 @@
+#pragma once
+
+#include <stdint.h>
+#include <atomic>
+
+// Single producer, single consumer ring of interleaved stereo 16-bit frames.
+// Neither side ever blocks: the producer drops frames that don't fit (overrun) and the consumer
+// pads with silence when the ring runs dry (underrun).
+struct SimAudioRing {
+public:
+
+	std::atomic<uint32_t> underruns;	// Frames of silence inserted by the consumer
+	std::atomic<uint32_t> overruns;		// Frames dropped by the producer
+
+	SimAudioRing(uint32_t capacityFrames);
+	~SimAudioRing();
+	uint32_t Capacity();
+	uint32_t Fill();
+	uint32_t Write(const int16_t* frames, uint32_t count);
+	uint32_t Read(int16_t* frames, uint32_t count);
+	void Clear();
+
+private:
+	int16_t* buffer;
+	uint32_t capacity;		// Power of two
+	uint32_t mask;
+	std::atomic<uint32_t> head;		// Written by producer
+	std::atomic<uint32_t> tail;		// Written by consumer
+};
@@ -0,0 +1,173 @@
+#include "sim_breakpoints.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+
+static const char* type_names[SimBreakpoint_TypeCount] = { "PC", "RAMR", "RAMW", "VRAMR", "VRAMW", "IOR", "IOW" };
+
+SimBreakpoints::SimBreakpoints()
+{
+	add_type = SimBreakpoint_Exec;
+	add_text[0] = 0;
+	step = false;
+	memset(last, 0, sizeof(last));
+	Clear();
+}
+
+SimBreakpoints::~SimBreakpoints()
+{
+}
+
+const char* SimBreakpoints::TypeName(SimBreakpoint_Type type)
+{
+	return type < SimBreakpoint_TypeCount ? type_names[type] : "?";
+}
+
+bool SimBreakpoints::ParseType(const char* name, SimBreakpoint_Type* type)
+{
+	char upper[8] = { 0 };
+	for (int i = 0; i < 7 && name[i]; i++) { upper[i] = (char)toupper((unsigned char)name[i]); }
+	for (int t = 0; t < SimBreakpoint_TypeCount; t++) {
+		if (!strcmp(upper, type_names[t])) {
+			*type = (SimBreakpoint_Type)t;
+			return true;
+		}
+	}
+	return false;
+}
+
+int SimBreakpoints::Add(SimBreakpoint_Type type, uint16_t address)
+{
+	if (type == SimBreakpoint_IoRead || type == SimBreakpoint_IoWrite) { address &= 0xFF; }
+	else if (type == SimBreakpoint_VramRead || type == SimBreakpoint_VramWrite) { address &= 0x3FFF; }
+	int index = Find(type, address);
+	if (index >= 0) {
+		SetEnabled(index, true);
+		return index;
+	}
+	SimBreakpoint breakpoint = { type, address, true, 0 };
+	list.push_back(breakpoint);
+	Update();
+	return (int)list.size() - 1;
+}
+
+void SimBreakpoints::Remove(int index)
+{
+	if (index < 0 || index >= (int)list.size()) { return; }
+	list.erase(list.begin() + index);
+	Update();
+}
+
+void SimBreakpoints::Remove(SimBreakpoint_Type type, uint16_t address)
+{
+	Remove(Find(type, address));
+}
+
+int SimBreakpoints::Find(SimBreakpoint_Type type, uint16_t address)
+{
+	for (int i = 0; i < (int)list.size(); i++) {
+		if (list[i].type == type && list[i].address == address) { return i; }
+	}
+	return -1;
+}
+
+void SimBreakpoints::SetEnabled(int index, bool enabled)
+{
+	if (index < 0 || index >= (int)list.size()) { return; }
+	list[index].enabled = enabled;
+	Update();
+}
+
+void SimBreakpoints::Clear()
+{
+	list.clear();
+	Update();
+	hit = false;
+	hit_step = false;
+	hit_type = SimBreakpoint_Exec;
+	hit_address = 0;
+}
+
+void SimBreakpoints::SetStep(bool step)
+{
+	this->step = step;
+	Update();
+}
+
+// Rebuilds the bitmaps from the list, only when the list changes
+void SimBreakpoints::Update()
+{
+	memset(bits, 0, sizeof(bits));
+	armed = step;
+	for (auto& breakpoint : list) {
+		if (!breakpoint.enabled) { continue; }
+		bits[breakpoint.type][breakpoint.address >> 3] |= 1 << (breakpoint.address & 7);
+		armed = true;
+	}
+}
+
+void SimBreakpoints::Hit(SimBreakpoint_Type type, uint16_t address, bool stepped)
+{
+	hit = true;
+	hit_step = stepped;
+	hit_type = type;
+	hit_address = address;
+	for (auto& breakpoint : list) {
+		if (breakpoint.enabled && breakpoint.type == type && breakpoint.address == address) { breakpoint.hits++; }
+	}
+}
+
+void SimBreakpoints::Draw(const char* title, bool* p_open, ImVec2 size)
+{
+	ImGui::SetNextWindowSize(size, ImGuiCond_Once);
+	if (!ImGui::Begin(title, p_open))
+	{
+		ImGui::End();
+		return;
+	}
+
+	ImGui::SetNextItemWidth(80);
+	ImGui::Combo("##type", &add_type, type_names, SimBreakpoint_TypeCount);
+	ImGui::SameLine();
+	ImGui::SetNextItemWidth(60);
+	bool add = ImGui::InputText("##address", add_text, sizeof(add_text), ImGuiInputTextFlags_CharsHexadecimal | ImGuiInputTextFlags_EnterReturnsTrue);
+	ImGui::SameLine();
+	add |= ImGui::SmallButton("Add");
+	if (add && add_text[0]) { Add((SimBreakpoint_Type)add_type, (uint16_t)strtoul(add_text, NULL, 16)); }
+	ImGui::SameLine();
+	if (ImGui::SmallButton("Clear")) { Clear(); }
+	if (hit) {
+		ImGui::SameLine();
+		ImGui::TextColored(ImVec4(1.0f, 0.4f, 0.4f, 1.0f), "Hit %s %04X", TypeName(hit_type), hit_address);
+	}
+
+	int remove = -1;
+	if (ImGui::BeginTable("breakpoints", 4, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingFixedFit | ImGuiTableFlags_ScrollY)) {
+		ImGui::TableSetupScrollFreeze(0, 1);
+		ImGui::TableSetupColumn("On");
+		ImGui::TableSetupColumn("Type");
+		ImGui::TableSetupColumn("Address");
+		ImGui::TableSetupColumn("Hits", ImGuiTableColumnFlags_WidthStretch);
+		ImGui::TableHeadersRow();
+		for (int i = 0; i < (int)list.size(); i++) {
+			SimBreakpoint& breakpoint = list[i];
+			ImGui::PushID(i);
+			ImGui::TableNextRow();
+			ImGui::TableNextColumn();
+			bool enabled = breakpoint.enabled;
+			if (ImGui::Checkbox("##on", &enabled)) { SetEnabled(i, enabled); }
+			ImGui::TableNextColumn(); ImGui::TextUnformatted(TypeName(breakpoint.type));
+			ImGui::TableNextColumn(); ImGui::Text("%04X", breakpoint.address);
+			ImGui::TableNextColumn(); ImGui::Text("%llu", (unsigned long long)breakpoint.hits);
+			ImGui::SameLine();
+			if (ImGui::SmallButton("X")) { remove = i; }
+			ImGui::PopID();
+		}
+		ImGui::EndTable();
+	}
+	if (remove >= 0) { Remove(remove); }
+
+	ImGui::End();
+}
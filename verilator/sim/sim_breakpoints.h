@@ -0,0 +1,73 @@
+#pragma once
+#include <stdint.h>
+#include <vector>
+#include "imgui.h"
+
+enum SimBreakpoint_Type {
+	SimBreakpoint_Exec,			// Opcode fetch (M1) at a PC
+	SimBreakpoint_RamRead,
+	SimBreakpoint_RamWrite,
+	SimBreakpoint_VramRead,		// VDP read-ahead for the CPU
+	SimBreakpoint_VramWrite,
+	SimBreakpoint_IoRead,		// PIO or VDP port, low 8 bits of the address
+	SimBreakpoint_IoWrite,
+	SimBreakpoint_TypeCount
+};
+
+struct SimBreakpoint {
+public:
+	SimBreakpoint_Type type;
+	uint16_t address;
+	bool enabled;
+	uint64_t hits;
+};
+
+// PC breakpoints and memory/IO watchpoints
+// Each type has a 64K bitmap of enabled addresses, so a check is a shift and a mask however many are set.
+// Access is called once per clk_sys cycle with each bus strobe and only fires on the strobe's rising edge.
+struct SimBreakpoints {
+public:
+
+	bool armed;			// Any breakpoint enabled or stepping, the sim loop skips the checks entirely when clear
+	bool step;			// Stop at the next opcode fetch whatever its address, set with SetStep
+	bool hit;			// Set by Access, cleared by the caller before running again
+	bool hit_step;		// Hit came from step rather than a breakpoint
+	SimBreakpoint_Type hit_type;
+	uint16_t hit_address;
+
+	SimBreakpoints();
+	~SimBreakpoints();
+	int Add(SimBreakpoint_Type type, uint16_t address);		// Returns the index, an existing breakpoint is re-enabled
+	void Remove(int index);
+	void Remove(SimBreakpoint_Type type, uint16_t address);
+	int Find(SimBreakpoint_Type type, uint16_t address);		// Index or -1
+	void SetEnabled(int index, bool enabled);
+	void Clear();
+	void SetStep(bool step);
+	int Count() { return (int)list.size(); }
+	const SimBreakpoint& Get(int index) { return list[index]; }
+	static const char* TypeName(SimBreakpoint_Type type);
+	static bool ParseType(const char* name, SimBreakpoint_Type* type);
+	void Draw(const char* title, bool* p_open, ImVec2 size);
+
+	inline bool Access(SimBreakpoint_Type type, bool strobe, uint16_t address) {
+		bool rising = strobe && !last[type];
+		last[type] = strobe;
+		if (!rising) { return false; }
+		bool set = bits[type][address >> 3] & (1 << (address & 7));
+		if (!set && !(step && type == SimBreakpoint_Exec)) { return false; }
+		Hit(type, address, !set);
+		return true;
+	}
+
+private:
+	uint8_t bits[SimBreakpoint_TypeCount][0x10000 / 8];
+	bool last[SimBreakpoint_TypeCount];
+	std::vector<SimBreakpoint> list;
+
+	int add_type;
+	char add_text[5];
+
+	void Hit(SimBreakpoint_Type type, uint16_t address, bool stepped);
+	void Update();
+};
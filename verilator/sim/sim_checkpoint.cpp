@@ -0,0 +1,112 @@
+#include "sim_checkpoint.h"
+
+SimCheckpoint_Save::SimCheckpoint_Save(std::vector<uint8_t>& buffer) : out(buffer)
+{
+	out.clear();
+	m_isOpen = true;
+	m_filename = "checkpoint";
+	m_cp = m_bufp;
+	header();
+}
+
+void SimCheckpoint_Save::close()
+{
+	if (!isOpen()) { return; }
+	trailer();
+	flush();
+	m_isOpen = false;
+}
+
+void SimCheckpoint_Save::flush()
+{
+	out.insert(out.end(), m_bufp, m_cp);
+	m_cp = m_bufp;
+}
+
+SimCheckpoint_Restore::SimCheckpoint_Restore(const std::vector<uint8_t>& buffer) : in(buffer)
+{
+	position = 0;
+	m_isOpen = true;
+	m_filename = "checkpoint";
+	m_cp = m_bufp;
+	m_endp = m_bufp;
+	header();
+}
+
+void SimCheckpoint_Restore::close()
+{
+	if (!isOpen()) { return; }
+	trailer();
+	m_isOpen = false;
+}
+
+void SimCheckpoint_Restore::fill()
+{
+	// Move the unread bytes down and top the buffer up from the snapshot
+	size_t remaining = m_endp - m_cp;
+	memmove(m_bufp, m_cp, remaining);
+	m_cp = m_bufp;
+	m_endp = m_bufp + remaining;
+	size_t space = bufferSize() - remaining;
+	size_t count = in.size() - position < space ? in.size() - position : space;
+	if (count) { memcpy(m_endp, &in[position], count); }
+	position += count;
+	m_endp += count;
+}
+
+SimCheckpoint::SimCheckpoint(int slots, vluint64_t interval)
+{
+	this->interval = interval;
+	next_time = 0;
+	replaying = false;
+	ring.resize(slots > 0 ? slots : 1);
+	newest = -1;
+	Clear();
+}
+
+SimCheckpoint_Snapshot* SimCheckpoint::Take(vluint64_t time)
+{
+	newest = (newest + 1) % (int)ring.size();
+	SimCheckpoint_Snapshot* snapshot = &ring[newest];
+	snapshot->valid = true;
+	snapshot->time = time;
+	next_time = time + interval;
+	return snapshot;
+}
+
+SimCheckpoint_Snapshot* SimCheckpoint::Before(vluint64_t time)
+{
+	SimCheckpoint_Snapshot* best = NULL;
+	for (auto& snapshot : ring) {
+		if (snapshot.valid && snapshot.time <= time && (!best || snapshot.time > best->time)) { best = &snapshot; }
+	}
+	return best;
+}
+
+int SimCheckpoint::Count()
+{
+	int count = 0;
+	for (auto& snapshot : ring) {
+		if (snapshot.valid) { count++; }
+	}
+	return count;
+}
+
+size_t SimCheckpoint::Bytes()
+{
+	size_t bytes = 0;
+	for (auto& snapshot : ring) {
+		if (snapshot.valid) { bytes += snapshot.model.size() + snapshot.state.size(); }
+	}
+	return bytes;
+}
+
+void SimCheckpoint::Clear()
+{
+	for (auto& snapshot : ring) {
+		snapshot.valid = false;
+		snapshot.time = 0;
+	}
+	newest = -1;
+	next_time = 0;
+}
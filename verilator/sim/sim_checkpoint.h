@@ -0,0 +1,86 @@
+#pragma once
+#include "verilated_heavy.h"
+#include "verilated_save.h"
+#include <stdint.h>
+#include <string.h>
+#include <vector>
+
+// VerilatedSerialize into a memory buffer, use as: SimCheckpoint_Save out(buffer); out << *top; out.close();
+// Needs the model verilated with --savable
+class SimCheckpoint_Save : public VerilatedSerialize {
+public:
+	SimCheckpoint_Save(std::vector<uint8_t>& buffer);
+	virtual ~SimCheckpoint_Save() override { close(); }
+	virtual void close() override;
+	virtual void flush() override;
+
+private:
+	std::vector<uint8_t>& out;
+};
+
+// VerilatedDeserialize from a memory buffer written by SimCheckpoint_Save
+class SimCheckpoint_Restore : public VerilatedDeserialize {
+public:
+	SimCheckpoint_Restore(const std::vector<uint8_t>& buffer);
+	virtual ~SimCheckpoint_Restore() override { close(); }
+	virtual void close() override;
+	virtual void fill() override;
+
+private:
+	const std::vector<uint8_t>& in;
+	size_t position;
+};
+
+// Copies harness variables to or from a snapshot, the same Field calls in the same order do both
+struct SimCheckpoint_State {
+public:
+	std::vector<uint8_t>& data;
+	bool saving;
+	size_t position;
+
+	SimCheckpoint_State(std::vector<uint8_t>& data, bool saving) : data(data), saving(saving), position(0) {
+		if (saving) { data.clear(); }
+	}
+
+	template<typename T>
+	void Field(T& value) {
+		if (saving) {
+			const uint8_t* p = (const uint8_t*)&value;
+			data.insert(data.end(), p, p + sizeof(T));
+		}
+		else if (position + sizeof(T) <= data.size()) {
+			memcpy((void*)&value, &data[position], sizeof(T));
+			position += sizeof(T);
+		}
+	}
+};
+
+struct SimCheckpoint_Snapshot {
+public:
+	bool valid;
+	vluint64_t time;
+	std::vector<uint8_t> model;
+	std::vector<uint8_t> state;
+};
+
+// Ring of in-memory model snapshots taken every interval sim cycles
+// Buffers are reused once the ring is full, so steady state snapshots do not allocate
+struct SimCheckpoint {
+public:
+
+	vluint64_t interval;
+	vluint64_t next_time;
+	bool replaying;		// Set while re-executing from a snapshot, no new snapshots are taken
+
+	SimCheckpoint(int slots, vluint64_t interval);
+	bool Due(vluint64_t time) { return interval > 0 && !replaying && time >= next_time; }
+	SimCheckpoint_Snapshot* Take(vluint64_t time);		// Oldest slot for the caller to fill
+	SimCheckpoint_Snapshot* Before(vluint64_t time);	// Newest snapshot taken at or before time
+	int Count();
+	size_t Bytes();
+	void Clear();
+
+private:
+	std::vector<SimCheckpoint_Snapshot> ring;
+	int newest;
+};
@@ -1,14 +1,17 @@
 #include "sim_console.h"
+#include "sim_log_sink.h"
 #include <string>
+#include <stdint.h>
+#include <deque>
+#include <chrono>
 #include "imgui.h"
-#define FMT_HEADER_ONLY
-#include <fmt/core.h>
 
 // Demonstrate creating a simple console window, with scrolling, filtering, completion and history.
 // For the console example, here we are using a more C++ like approach of declaring a class to hold the data and the functions.
 
 char                  InputBuf[256];
 ImVector<const char*> Commands;
+ImVector<DebugConsole_CommandHandler> CommandHandlers;		// Parallel to Commands, NULL for the built in ones
 ImVector<char*>       History;
 int                   HistoryPos;    // -1: new line, 0..History.Size-1 browsing history.
 ImGuiTextFilter       Filter;
@@ -16,23 +19,209 @@ bool                  AutoScroll;
 bool                  ScrollToBottom;
 
 
-ImVector<char*>       Items;
 static char* Strdup(const char* str) { size_t len = strlen(str) + 1; void* buf = malloc(len); IM_ASSERT(buf); return (char*)memcpy(buf, (const void*)str, len); }
 
-void DebugConsole::AddLog(const char* fmt, ...) IM_FMTARGS(2)
+// Log storage
+// -----------
+// Entries live in a fixed-capacity ring and their text in a circular bump arena, both evicted oldest first.
+// Text is formatted once into the arena and the sim time is kept as an integer until the line is drawn.
+// Deferred entries keep their format pointer and store packed arguments in the arena instead of text:
+//   uint8 count, uint8 types[count], uint64 values[count], then copies of any string arguments
+struct DebugConsole_Entry {
+	uint64_t time;
+	const char* fmt;	// Format for deferred entries, NULL when the arena holds text
+	uint32_t offset;	// Start of null terminated text or packed arguments in log_arena
+	uint32_t length;	// Bytes used in log_arena, including the terminator
+};
+
+const uint32_t log_capacity = 1 << 18;
+const uint32_t log_arena_size = 16 << 20;
+const uint32_t log_string_limit = 1024;	// String argument bytes kept per deferred entry, as AddLog's line buffer
+DebugConsole_Entry log_entries[log_capacity];
+char log_arena[log_arena_size];
+uint32_t log_first;		// Ring index of oldest entry
+uint32_t log_count;
+uint32_t log_arena_head;	// Next free arena byte
+uint64_t log_first_id;		// Sequence number of the oldest entry, ids keep counting across eviction
+uint32_t log_window = log_capacity;	// Lines kept in memory, reduced while a log file is open
+SimLogSink log_sink;
+
+static void LogEvictOldest()
+{
+	log_first = (log_first + 1) % log_capacity;
+	log_count--;
+	log_first_id++;
+}
+
+static DebugConsole_Entry& LogEntry(uint32_t index)
+{
+	return log_entries[(log_first + index) % log_capacity];
+}
+
+static DebugConsole_Entry& LogAllocate(uint64_t time, uint32_t need)
+{
+	while (log_count >= log_window) { LogEvictOldest(); }
+
+	// Wrap when the text won't fit before the end, everything still stored past the old head is the oldest
+	if (log_arena_head + need > log_arena_size) {
+		while (log_count > 0 && LogEntry(0).offset >= log_arena_head) { LogEvictOldest(); }
+		log_arena_head = 0;
+	}
+	while (log_count > 0) {
+		DebugConsole_Entry& oldest = LogEntry(0);
+		if (oldest.offset >= log_arena_head + need || oldest.offset + oldest.length <= log_arena_head) { break; }
+		LogEvictOldest();
+	}
+
+	DebugConsole_Entry& entry = log_entries[(log_first + log_count) % log_capacity];
+	entry.time = time;
+	entry.fmt = NULL;
+	entry.offset = log_arena_head;
+	entry.length = need;
+	log_count++;
+	log_arena_head += need;
+	return entry;
+}
+
+static void LogAppend(uint64_t time, const char* text, uint32_t length)
+{
+	DebugConsole_Entry& entry = LogAllocate(time, length + 1);
+	memcpy(&log_arena[entry.offset], text, length);
+	log_arena[entry.offset + length] = 0;
+	if (log_sink.active) { log_sink.Push(time, NULL, text, length); }
+}
+
+// Expand a deferred entry, only the conversions printf needs for the argument types captured are supported
+static void LogFormatDeferred(const char* fmt, const uint8_t* record, char* out, int size)
+{
+	int count = record[0];
+	const uint8_t* types = record + 1;
+	const uint8_t* values = types + count;
+	int arg = 0;
+	int pos = 0;
+	const char* f = fmt;
+	while (*f && pos < size - 1) {
+		if (*f != '%') { out[pos++] = *f++; continue; }
+		if (f[1] == '%') { out[pos++] = '%'; f += 2; continue; }
+
+		// Copy flags, width and precision, drop length modifiers and add our own
+		char spec[32];
+		int s = 0;
+		spec[s++] = *f++;
+		while (*f && strchr("-+ #0123456789.*hljztL", *f) && s < 24) {
+			if (*f == '*') {
+				uint64_t v = 0;
+				if (arg < count) { memcpy(&v, values + arg * 8, 8); arg++; }
+				int n = snprintf(&spec[s], 24 - s, "%d", (int)v);
+				if (n > 0) { s = s + n < 23 ? s + n : 23; }
+			}
+			else if (!strchr("hljztL", *f)) { spec[s++] = *f; }
+			f++;
+		}
+		char conv = *f ? *f++ : 0;
+		uint64_t v = 0;
+		uint8_t type = DebugConsole_ArgInt;
+		if (arg < count) { memcpy(&v, values + arg * 8, 8); type = types[arg]; arg++; }
+		int n = 0;
+		switch (conv) {
+		case 'd': case 'i':
+			spec[s++] = 'l'; spec[s++] = 'l'; spec[s++] = conv; spec[s] = 0;
+			n = snprintf(out + pos, size - pos, spec, (long long)v);
+			break;
+		case 'u': case 'x': case 'X': case 'o':
+			spec[s++] = 'l'; spec[s++] = 'l'; spec[s++] = conv; spec[s] = 0;
+			n = snprintf(out + pos, size - pos, spec, (unsigned long long)v);
+			break;
+		case 'c':
+			spec[s++] = conv; spec[s] = 0;
+			n = snprintf(out + pos, size - pos, spec, (int)v);
+			break;
+		case 'f': case 'F': case 'e': case 'E': case 'g': case 'G': case 'a': case 'A': {
+			double d;
+			if (type == DebugConsole_ArgDouble) { memcpy(&d, &v, sizeof(double)); }
+			else { d = type == DebugConsole_ArgInt ? (double)(long long)v : (double)v; }
+			spec[s++] = conv; spec[s] = 0;
+			n = snprintf(out + pos, size - pos, spec, d);
+			break;
+		}
+		case 's':
+			spec[s++] = conv; spec[s] = 0;
+			n = snprintf(out + pos, size - pos, spec, type == DebugConsole_ArgString ? (const char*)record + v : "(null)");
+			break;
+		case 'p':
+			spec[s++] = conv; spec[s] = 0;
+			n = snprintf(out + pos, size - pos, spec, (void*)(uintptr_t)v);
+			break;
+		default:
+			break;
+		}
+		if (n > 0) { pos += n; }
+		if (pos > size - 1) { pos = size - 1; }
+	}
+	out[pos] = 0;
+}
+
+// Text of an entry, deferred entries are formatted into buf
+static const char* LogText(const DebugConsole_Entry& entry, char* buf, int size)
+{
+	if (!entry.fmt) { return &log_arena[entry.offset]; }
+	LogFormatDeferred(entry.fmt, (const uint8_t*)&log_arena[entry.offset], buf, size);
+	return buf;
+}
+
+// Stored length of a string argument including its terminator, truncated to what is left of log_string_limit
+static uint32_t LogStringLength(const char* str, uint32_t used)
+{
+	uint32_t len = (uint32_t)strlen(str);
+	uint32_t room = used + 1 < log_string_limit ? log_string_limit - used - 1 : 0;
+	return (len < room ? len : room) + 1;
+}
+
+void DebugConsole::AddLogPacked(const char* fmt, const DebugConsole_Arg* args, int count)
+{
+	if (count > 255) { count = 255; }
+	uint32_t strings = 0;
+	for (int i = 0; i < count; i++) {
+		if (args[i].type == DebugConsole_ArgString && args[i].value) { strings += LogStringLength((const char*)(uintptr_t)args[i].value, strings); }
+	}
+
+	uint32_t header = 1 + count + (count * 8);
+	DebugConsole_Entry& entry = LogAllocate(main_time, header + strings);
+	entry.fmt = fmt;
+	uint8_t* record = (uint8_t*)&log_arena[entry.offset];
+	record[0] = (uint8_t)count;
+	uint32_t string_pos = header;
+	for (int i = 0; i < count; i++) {
+		uint64_t value = args[i].value;
+		uint8_t type = args[i].type;
+		if (type == DebugConsole_ArgString) {
+			// Strings are stored as an offset from the start of the record
+			if (value) {
+				const char* str = (const char*)(uintptr_t)value;
+				uint32_t len = LogStringLength(str, string_pos - header);
+				memcpy(record + string_pos, str, len - 1);
+				record[string_pos + len - 1] = 0;
+				value = string_pos;
+				string_pos += len;
+			}
+			else { type = DebugConsole_ArgPointer; }
+		}
+		record[1 + i] = type;
+		memcpy(record + 1 + count + (i * 8), &value, 8);
+	}
+	if (log_sink.active) { log_sink.Push(entry.time, fmt, record, entry.length); }
+}
+
+void DebugConsole::AddLog(const char* fmt, ...)
 {
-	// FIXME-OPT
 	char buf[1024];
 	va_list args;
 	va_start(args, fmt);
-	vsnprintf(buf, IM_ARRAYSIZE(buf), fmt, args);
-	buf[IM_ARRAYSIZE(buf) - 1] = 0;
+	int length = vsnprintf(buf, IM_ARRAYSIZE(buf), fmt, args);
 	va_end(args);
-	std::string message = "{0} > ";
-	message.append(buf);
-	message = fmt::format(message.c_str(), main_time);
-	Items.push_back(Strdup(message.c_str()));
-	/*Items.push_back(Strdup(buf));*/
+	if (length < 0) { length = 0; }
+	if (length > IM_ARRAYSIZE(buf) - 1) { length = IM_ARRAYSIZE(buf) - 1; }
+	LogAppend(main_time, buf, length);
 }
 
 DebugConsole::DebugConsole()
@@ -40,9 +229,9 @@ DebugConsole::DebugConsole()
 	ClearLog();
 	memset(InputBuf, 0, sizeof(InputBuf));
 	HistoryPos = -1;
-	Commands.push_back("HELP");
-	Commands.push_back("HISTORY");
-	Commands.push_back("CLEAR");
+	AddCommand("HELP", NULL);
+	AddCommand("HISTORY", NULL);
+	AddCommand("CLEAR", NULL);
 	AutoScroll = true;
 	ScrollToBottom = false;
 	AddLog("Sim start");
@@ -63,30 +252,91 @@ static void  Strtrim(char* str) { char* str_end = str + strlen(str); while (str_
 
 void DebugConsole::ClearLog()
 {
-	for (int i = 0; i < Items.Size; i++)
-		free(Items[i]);
-	Items.clear();
+	log_first_id += log_count;
+	log_first = 0;
+	log_count = 0;
+	log_arena_head = 0;
+}
+
+bool DebugConsole::OpenLogFile(const char* base, uint64_t rotateBytes, int keepFiles, bool compress, unsigned int window)
+{
+	if (!log_sink.Open(base, rotateBytes, keepFiles, compress, LogFormatDeferred)) { return false; }
+	// Everything goes to the file, the console only needs a recent window
+	log_window = window > 0 && window < log_capacity ? window : log_capacity;
+	LimitTo(log_window);
+	return true;
+}
+
+void DebugConsole::CloseLogFile()
+{
+	log_sink.Close();
+	log_window = log_capacity;
 }
 
 void DebugConsole::LimitTo(unsigned int max)
 {
-	ImVector<char*>       NewItems;
-	int count = Items.Size;
-	signed int start = count - max;
-	if (start < 0) { start = 0; }
-	for (int i = 0; i < count; i++)
-	{
-		if (i < start) {
-			free(Items[i]);
-		}
-		else {
-			NewItems.push_back(Items[i]);
-		}
+	while (log_count > max) { LogEvictOldest(); }
+}
+
+// Filtered view
+// -------------
+// Ids of entries passing Filter, in order. New lines are tested as they arrive and evicted ids are dropped from
+// the front. A filter change restarts the scan, which is spread over several GUI frames within filter_budget_ms.
+std::deque<uint64_t> filter_index;
+uint64_t filter_scanned;		// Next id to test
+const double filter_budget_ms = 4.0;
+
+static void FilterReset()
+{
+	filter_index.clear();
+	filter_scanned = log_first_id;
+}
+
+static void FilterUpdate()
+{
+	while (!filter_index.empty() && filter_index.front() < log_first_id) { filter_index.pop_front(); }
+	if (filter_scanned < log_first_id) { filter_scanned = log_first_id; }
+
+	char text_buf[1024];
+	uint64_t end_id = log_first_id + log_count;
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	while (filter_scanned < end_id) {
+		const DebugConsole_Entry& entry = LogEntry((uint32_t)(filter_scanned - log_first_id));
+		if (Filter.PassFilter(LogText(entry, text_buf, sizeof(text_buf)))) { filter_index.push_back(filter_scanned); }
+		filter_scanned++;
+		if ((filter_scanned & 1023) == 0 && std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() > filter_budget_ms) { break; }
 	}
-	Items.clear();
-	for (int i = start; i < count; i++) {
-		Items.push_back(NewItems[i - start]);
+}
+
+static void DrawEntry(const DebugConsole_Entry& entry)
+{
+	char text_buf[1024];
+	const char* item = LogText(entry, text_buf, sizeof(text_buf));
+	char time_buf[24];
+	snprintf(time_buf, sizeof(time_buf), "%llu > ", (unsigned long long)entry.time);
+	ImGui::TextUnformatted(time_buf);
+	ImGui::SameLine(0, 0);
+
+	// Normally you would store more information in your item (e.g. make Items[] an array of structure, store color/type etc.)
+	bool pop_color = false;
+	if (strstr(item, "[error]")) { ImGui::PushStyleColor(ImGuiCol_Text, ImVec4(1.0f, 0.4f, 0.4f, 1.0f)); pop_color = true; }
+	else if (strncmp(item, "# ", 2) == 0) { ImGui::PushStyleColor(ImGuiCol_Text, ImVec4(1.0f, 0.8f, 0.6f, 1.0f)); pop_color = true; }
+	ImGui::TextUnformatted(item);
+	if (pop_color)
+		ImGui::PopStyleColor();
+}
+
+bool DebugConsole::ExportLog(const char* filename)
+{
+	FILE* file = fopen(filename, "w");
+	if (!file) { return false; }
+	char text_buf[1024];
+	for (uint32_t i = 0; i < log_count; i++) {
+		DebugConsole_Entry& entry = LogEntry(i);
+		fprintf(file, "%llu > %s\n", (unsigned long long)entry.time, LogText(entry, text_buf, sizeof(text_buf)));
 	}
+	fclose(file);
+	return true;
 }
 
 void DebugConsole::Draw(const char* title, bool* p_open, ImVec2 size)
@@ -112,7 +362,12 @@ void DebugConsole::Draw(const char* title, bool* p_open, ImVec2 size)
 	// TODO: display items starting from the bottom
 
 	if (ImGui::SmallButton("Clear")) { ClearLog(); } ImGui::SameLine();
-	bool copy_to_clipboard = ImGui::SmallButton("Copy");
+	bool copy_to_clipboard = ImGui::SmallButton("Copy"); ImGui::SameLine();
+	if (ImGui::SmallButton("Export")) { ExportLog("console.log"); }
+	if (log_sink.active) {
+		ImGui::SameLine();
+		ImGui::Text("File: segment %d, %.1f MB written, %llu dropped", log_sink.segment.load(), log_sink.bytes_written.load() / 1048576.0, (unsigned long long)log_sink.dropped.load());
+	}
 
 	ImGui::Separator();
 
@@ -127,7 +382,16 @@ void DebugConsole::Draw(const char* title, bool* p_open, ImVec2 size)
 	if (ImGui::Button("Options"))
 		ImGui::OpenPopup("Options");
 	ImGui::SameLine();
-	Filter.Draw("Filter (\"incl,-excl\") (\"error\")", 180);
+	if (Filter.Draw("Filter (\"incl,-excl\") (\"error\")", 180)) { FilterReset(); }
+	bool filtering = Filter.IsActive();
+	if (filtering) {
+		FilterUpdate();
+		uint64_t end_id = log_first_id + log_count;
+		if (filter_scanned < end_id) {
+			ImGui::SameLine();
+			ImGui::Text("Filtering %.0f%%", log_count > 0 ? 100.0 * (log_count - (end_id - filter_scanned)) / log_count : 100.0);
+		}
+	}
 	ImGui::Separator();
 
 	const float footer_height_to_reserve = ImGui::GetStyle().ItemSpacing.y + ImGui::GetFrameHeightWithSpacing(); // 1 separator, 1 input text
@@ -138,33 +402,24 @@ void DebugConsole::Draw(const char* title, bool* p_open, ImVec2 size)
 		ImGui::EndPopup();
 	}
 
-	// Display every line as a separate entry so we can change their color or add custom widgets. If you only want raw text you can use ImGui::TextUnformatted(log.begin(), log.end());
-	// NB- if you have thousands of entries this approach may be too inefficient and may require user-side clipping to only process visible items.
-	// You can seek and display only the lines that are visible using the ImGuiListClipper helper, if your elements are evenly spaced and you have cheap random access to the elements.
-	// To use the clipper we could replace the 'for (int i = 0; i < Items.Size; i++)' loop with:
-	//     ImGuiListClipper clipper(Items.Size);
-	//     while (clipper.Step())
-	//         for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; i++)
-	// However, note that you can not use this code as is if a filter is active because it breaks the 'cheap random-access' property. We would need random-access on the post-filtered list.
-	// A typical application wanting coarse clipping and filtering may want to pre-compute an array of indices that passed the filtering test, recomputing this array when user changes the filter,
-	// and appending newly elements as they are inserted. This is left as a task to the user until we can manage to improve this example code!
-	// If your items are of variable size you may want to implement code similar to what ImGuiListClipper does. Or split your data into fixed height items to allow random-seeking into your list.
+	// Only the visible rows are formatted and drawn, through the filtered index when a filter is active
 	ImGui::PushStyleVar(ImGuiStyleVar_ItemSpacing, ImVec2(4, 1)); // Tighten spacing
 	if (copy_to_clipboard)
 		ImGui::LogToClipboard();
-	for (int i = 0; i < Items.Size; i++)
-	{
-		const char* item = Items[i];
-		if (!Filter.PassFilter(item))
-			continue;
-
-		// Normally you would store more information in your item (e.g. make Items[] an array of structure, store color/type etc.)
-		bool pop_color = false;
-		if (strstr(item, "[error]")) { ImGui::PushStyleColor(ImGuiCol_Text, ImVec4(1.0f, 0.4f, 0.4f, 1.0f)); pop_color = true; }
-		else if (strncmp(item, "# ", 2) == 0) { ImGui::PushStyleColor(ImGuiCol_Text, ImVec4(1.0f, 0.8f, 0.6f, 1.0f)); pop_color = true; }
-		ImGui::TextUnformatted(item);
-		if (pop_color)
-			ImGui::PopStyleColor();
+	int rows = filtering ? (int)filter_index.size() : (int)log_count;
+	if (copy_to_clipboard) {
+		for (int i = 0; i < rows; i++) {
+			DrawEntry(LogEntry(filtering ? (uint32_t)(filter_index[i] - log_first_id) : i));
+		}
+	}
+	else {
+		ImGuiListClipper clipper;
+		clipper.Begin(rows);
+		while (clipper.Step()) {
+			for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; i++) {
+				DrawEntry(LogEntry(filtering ? (uint32_t)(filter_index[i] - log_first_id) : i));
+			}
+		}
 	}
 	if (copy_to_clipboard)
 		ImGui::LogFinish();
@@ -198,6 +453,12 @@ void DebugConsole::Draw(const char* title, bool* p_open, ImVec2 size)
 	ImGui::End();
 }
 
+void    DebugConsole::AddCommand(const char* name, DebugConsole_CommandHandler handler)
+{
+	Commands.push_back(name);
+	CommandHandlers.push_back(handler);
+}
+
 void    DebugConsole::ExecCommand(const char* command_line)
 {
 	AddLog("# %s\n", command_line);
@@ -232,7 +493,18 @@ void    DebugConsole::ExecCommand(const char* command_line)
 	}
 	else
 	{
-		this->AddLog("Unknown command: '%s'\n", command_line);
+		// Registered commands match on the first word, the rest is passed to the handler
+		size_t name_length = strcspn(command_line, " ");
+		const char* args = command_line + name_length;
+		while (*args == ' ') { args++; }
+		int found = -1;
+		for (int i = 0; i < Commands.Size; i++) {
+			if (CommandHandlers[i] && strlen(Commands[i]) == name_length && Strnicmp(Commands[i], command_line, (int)name_length) == 0) { found = i; break; }
+		}
+		if (found >= 0)
+			CommandHandlers[found](args);
+		else
+			this->AddLog("Unknown command: '%s'\n", command_line);
 	}
 
 	// On commad input, we scroll to bottom even if AutoScroll==false
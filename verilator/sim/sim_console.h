@@ -1,17 +1,67 @@
 #pragma once
 #include "imgui.h"
+#include <stdint.h>
+#include <string.h>
+
+// Raw argument captured by AddLogDeferred
+struct DebugConsole_Arg {
+	uint64_t value;
+	uint8_t type;
+};
+
+enum DebugConsole_ArgType {
+	DebugConsole_ArgInt,
+	DebugConsole_ArgUInt,
+	DebugConsole_ArgDouble,
+	DebugConsole_ArgString,
+	DebugConsole_ArgPointer
+};
+
+inline DebugConsole_Arg DebugConsole_MakeArg(long long v) { DebugConsole_Arg a = { (uint64_t)v, DebugConsole_ArgInt }; return a; }
+inline DebugConsole_Arg DebugConsole_MakeArg(long v) { return DebugConsole_MakeArg((long long)v); }
+inline DebugConsole_Arg DebugConsole_MakeArg(int v) { return DebugConsole_MakeArg((long long)v); }
+inline DebugConsole_Arg DebugConsole_MakeArg(short v) { return DebugConsole_MakeArg((long long)v); }
+inline DebugConsole_Arg DebugConsole_MakeArg(signed char v) { return DebugConsole_MakeArg((long long)v); }
+inline DebugConsole_Arg DebugConsole_MakeArg(char v) { return DebugConsole_MakeArg((long long)v); }
+inline DebugConsole_Arg DebugConsole_MakeArg(unsigned long long v) { DebugConsole_Arg a = { (uint64_t)v, DebugConsole_ArgUInt }; return a; }
+inline DebugConsole_Arg DebugConsole_MakeArg(unsigned long v) { return DebugConsole_MakeArg((unsigned long long)v); }
+inline DebugConsole_Arg DebugConsole_MakeArg(unsigned int v) { return DebugConsole_MakeArg((unsigned long long)v); }
+inline DebugConsole_Arg DebugConsole_MakeArg(unsigned short v) { return DebugConsole_MakeArg((unsigned long long)v); }
+inline DebugConsole_Arg DebugConsole_MakeArg(unsigned char v) { return DebugConsole_MakeArg((unsigned long long)v); }
+inline DebugConsole_Arg DebugConsole_MakeArg(bool v) { return DebugConsole_MakeArg((unsigned long long)v); }
+inline DebugConsole_Arg DebugConsole_MakeArg(double v) { DebugConsole_Arg a; memcpy(&a.value, &v, sizeof(double)); a.type = DebugConsole_ArgDouble; return a; }
+inline DebugConsole_Arg DebugConsole_MakeArg(float v) { return DebugConsole_MakeArg((double)v); }
+inline DebugConsole_Arg DebugConsole_MakeArg(const char* v) { DebugConsole_Arg a = { (uint64_t)(uintptr_t)v, DebugConsole_ArgString }; return a; }
+inline DebugConsole_Arg DebugConsole_MakeArg(const void* v) { DebugConsole_Arg a = { (uint64_t)(uintptr_t)v, DebugConsole_ArgPointer }; return a; }
+
+// Handler for a command registered with DebugConsole::AddCommand, args is the text after the command name
+typedef void (*DebugConsole_CommandHandler)(const char* args);
 
 struct DebugConsole {
 public:
 
-	long main_time;
+	long main_time;		// Stamped on each line as it is added
 
 	void AddLog(const char* fmt, ...) IM_FMTARGS(2);
+
+	// Stores the format pointer, sim time and raw arguments, the line is only formatted when drawn or exported.
+	// fmt must outlive the log (use a string literal), string arguments are copied.
+	template<typename... Args>
+	void AddLogDeferred(const char* fmt, Args... args) {
+		DebugConsole_Arg packed[sizeof...(Args) + 1] = { DebugConsole_MakeArg(args)... };
+		AddLogPacked(fmt, packed, (int)sizeof...(Args));
+	}
+	void AddLogPacked(const char* fmt, const DebugConsole_Arg* args, int count);
+
 	DebugConsole();
 	~DebugConsole();
-	void ClearLog(); 
+	void ClearLog();
 	void LimitTo(unsigned int max);
+	bool ExportLog(const char* filename);
+	bool OpenLogFile(const char* base, uint64_t rotateBytes, int keepFiles, bool compress, unsigned int window);
+	void CloseLogFile();
 	void Draw(const char* title, bool* p_open, ImVec2 size);
+	void    AddCommand(const char* name, DebugConsole_CommandHandler handler);
 	void    ExecCommand(const char* command_line);
 	int     TextEditCallback(ImGuiInputTextCallbackData* data);
 };
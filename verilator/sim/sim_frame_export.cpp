@@ -0,0 +1,135 @@
+#include "sim_frame_export.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#ifndef _MSC_VER
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#else
+#define WIN32
+#include <windows.h>
+HANDLE export_mapping = NULL;
+#endif
+
+const size_t slot_align = 64;
+
+SimFrameExport::SimFrameExport()
+{
+	active = false;
+	sequence = 0;
+	header = NULL;
+	base = NULL;
+	size = 0;
+	name[0] = 0;
+}
+
+SimFrameExport::~SimFrameExport()
+{
+	Close();
+}
+
+bool SimFrameExport::Open(const char* name, int width, int height, int bpp, const uint32_t* palette, int slots)
+{
+	Close();
+	if (slots < 2) { slots = 2; }
+
+	size_t header_size = (sizeof(SimFrameExport_Header) + slot_align - 1) & ~(slot_align - 1);
+	size_t frame_size = ((size_t)width * height * bpp) / 8;
+	size_t slot_stride = (sizeof(SimFrameExport_Slot) + frame_size + slot_align - 1) & ~(slot_align - 1);
+	size = header_size + (slot_stride * slots);
+
+#ifndef WIN32
+	int fd = shm_open(name, O_CREAT | O_RDWR, 0600);
+	if (fd < 0) {
+		printf("Frame export: unable to open shared memory %s\n", name);
+		return false;
+	}
+	if (ftruncate(fd, size) != 0) {
+		printf("Frame export: unable to size shared memory %s\n", name);
+		close(fd);
+		shm_unlink(name);
+		return false;
+	}
+	void* ptr = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	close(fd);
+	if (ptr == MAP_FAILED) {
+		printf("Frame export: unable to map shared memory %s\n", name);
+		shm_unlink(name);
+		return false;
+	}
+#else
+	export_mapping = CreateFileMappingA(INVALID_HANDLE_VALUE, NULL, PAGE_READWRITE, (DWORD)((uint64_t)size >> 32), (DWORD)size, name);
+	if (export_mapping == NULL) {
+		printf("Frame export: unable to open shared memory %s\n", name);
+		return false;
+	}
+	void* ptr = MapViewOfFile(export_mapping, FILE_MAP_ALL_ACCESS, 0, 0, size);
+	if (ptr == NULL) {
+		printf("Frame export: unable to map shared memory %s\n", name);
+		CloseHandle(export_mapping);
+		export_mapping = NULL;
+		return false;
+	}
+#endif
+
+	strncpy(this->name, name, sizeof(this->name) - 1);
+	this->name[sizeof(this->name) - 1] = 0;
+	base = (uint8_t*)ptr;
+	memset(base, 0, size);
+
+	// Sequence is written last so readers never see a header without a layout
+	header = (SimFrameExport_Header*)base;
+	header->version = SIM_FRAME_EXPORT_VERSION;
+	header->header_size = (uint32_t)header_size;
+	header->width = width;
+	header->height = height;
+	header->bpp = bpp;
+	header->stride = (width * bpp) / 8;
+	header->slot_count = slots;
+	header->slot_size = (uint32_t)frame_size;
+	header->slot_stride = (uint32_t)slot_stride;
+	if (palette && bpp < 32) {
+		memcpy(header->palette, palette, (bpp == 4 ? 16 : 256) * sizeof(uint32_t));
+	}
+	memcpy(header->magic, SIM_FRAME_EXPORT_MAGIC, sizeof(header->magic));
+	header->sequence.store(0, std::memory_order_release);
+
+	sequence = 0;
+	active = true;
+	printf("Frame export: %s, %dx%d %dbpp, %d slots (%zu bytes)\n", name, width, height, bpp, slots, size);
+	return true;
+}
+
+void SimFrameExport::Publish(const void* data, uint64_t frame, uint64_t sim_time)
+{
+	if (!active) { return; }
+
+	// Seqlock per slot: mark as being written, copy frame, then publish the new sequence number
+	sequence++;
+	SimFrameExport_Slot* slot = (SimFrameExport_Slot*)(base + header->header_size + (((sequence - 1) % header->slot_count) * header->slot_stride));
+	slot->sequence.store(0, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_release);
+	slot->frame = frame;
+	slot->sim_time = sim_time;
+	memcpy((uint8_t*)slot + sizeof(SimFrameExport_Slot), data, header->slot_size);
+	slot->sequence.store(sequence, std::memory_order_release);
+	header->sequence.store(sequence, std::memory_order_release);
+}
+
+void SimFrameExport::Close()
+{
+	if (!base) { return; }
+#ifndef WIN32
+	munmap(base, size);
+	shm_unlink(name);
+#else
+	UnmapViewOfFile(base);
+	CloseHandle(export_mapping);
+	export_mapping = NULL;
+#endif
+	base = NULL;
+	header = NULL;
+	active = false;
+}
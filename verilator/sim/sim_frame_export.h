@@ -0,0 +1,58 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <atomic>
+
+// Shared memory layout
+// --------------------
+// [SimFrameExport_Header][slot 0][slot 1]...[slot n-1]
+// Each slot is a SimFrameExport_Slot followed by slot_size bytes of frame data, padded to 64 bytes.
+// A slot's sequence is 0 while it is being written, and is set to the frame's sequence number once complete.
+// header.sequence is the sequence number of the latest completed frame, which lives in slot (sequence - 1) % slot_count.
+// Readers should check the slot sequence before and after using the data and discard the frame if it changed.
+
+#define SIM_FRAME_EXPORT_MAGIC "BBCBCFRM"
+#define SIM_FRAME_EXPORT_VERSION 1
+
+struct SimFrameExport_Header {
+	char magic[8];
+	uint32_t version;
+	uint32_t header_size;
+	uint32_t width;
+	uint32_t height;
+	uint32_t bpp;				// 4 or 8 = palette indices (4bpp packs the left pixel in the low nibble), 32 = RGBA
+	uint32_t stride;			// Bytes per row
+	uint32_t slot_count;
+	uint32_t slot_size;			// Bytes of frame data per slot
+	uint32_t slot_stride;		// Bytes between slot headers
+	uint32_t reserved;
+	uint32_t palette[256];		// 0xAABBGGRR
+	std::atomic<uint64_t> sequence;
+};
+
+struct SimFrameExport_Slot {
+	std::atomic<uint64_t> sequence;
+	uint64_t frame;
+	uint64_t sim_time;
+	uint64_t reserved;
+};
+
+struct SimFrameExport {
+public:
+
+	bool active;
+	uint64_t sequence;
+
+	SimFrameExport();
+	~SimFrameExport();
+	bool Open(const char* name, int width, int height, int bpp, const uint32_t* palette, int slots);
+	void Publish(const void* data, uint64_t frame, uint64_t sim_time);
+	void Close();
+
+private:
+	SimFrameExport_Header* header;
+	uint8_t* base;
+	size_t size;
+	char name[128];
+};
@@ -0,0 +1,488 @@
+#include "sim_gdb.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef _MSC_VER
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <errno.h>
+#define close_socket close
+static bool WouldBlock() { return errno == EAGAIN || errno == EWOULDBLOCK; }
+#else
+#define WIN32
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#pragma comment(lib, "ws2_32.lib")
+#define close_socket closesocket
+static bool WouldBlock() { return WSAGetLastError() == WSAEWOULDBLOCK; }
+#endif
+
+#include "sim_console.h"
+#include "sim_z80_disasm.h"
+
+static DebugConsole console;
+
+static const int signal_int = 2;
+static const int signal_trap = 5;
+static const int max_memory = 0x800;		// Largest m/M transfer, advertised as PacketSize
+
+static const char* target_xml = "<?xml version=\"1.0\"?><!DOCTYPE target SYSTEM \"gdb-target.dtd\"><target><architecture>z80</architecture></target>";
+
+static const char hex_digits[] = "0123456789abcdef";
+
+static void SetNonBlocking(intptr_t socket)
+{
+#ifdef WIN32
+	u_long mode = 1;
+	ioctlsocket((SOCKET)socket, FIONBIO, &mode);
+#else
+	fcntl((int)socket, F_SETFL, fcntl((int)socket, F_GETFL, 0) | O_NONBLOCK);
+#endif
+}
+
+static void AppendByte(std::string& out, uint8_t value)
+{
+	out += hex_digits[value >> 4];
+	out += hex_digits[value & 15];
+}
+
+static int HexValue(char c)
+{
+	if (c >= '0' && c <= '9') { return c - '0'; }
+	if (c >= 'a' && c <= 'f') { return c - 'a' + 10; }
+	if (c >= 'A' && c <= 'F') { return c - 'A' + 10; }
+	return -1;
+}
+
+SimGdb::SimGdb(SimBreakpoints* breakpoints, SimGdb_Target target)
+{
+	this->breakpoints = breakpoints;
+	this->target = target;
+	listener = -1;
+	client = -1;
+	state = Detached;
+	resume = true;
+	stop_pc = 0;
+	stop_signal = signal_trap;
+	report_stop = false;
+	watch_pending = false;
+	watch_type = SimBreakpoint_RamWrite;
+	watch_address = 0;
+	last_fetch_valid = false;
+	last_fetch = 0;
+}
+
+SimGdb::~SimGdb()
+{
+	Close();
+}
+
+bool SimGdb::Listen(int port)
+{
+#ifdef WIN32
+	WSADATA wsa;
+	if (WSAStartup(MAKEWORD(2, 2), &wsa) != 0) {
+		printf("GDB: cannot initialise sockets\n");
+		return false;
+	}
+#endif
+	intptr_t socket_handle = (intptr_t)socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+	if (socket_handle == -1) {
+		printf("GDB: cannot create socket\n");
+		return false;
+	}
+	int reuse = 1;
+	setsockopt(socket_handle, SOL_SOCKET, SO_REUSEADDR, (const char*)&reuse, sizeof(reuse));
+
+	// Local connections only, the stub has no authentication
+	sockaddr_in address;
+	memset(&address, 0, sizeof(address));
+	address.sin_family = AF_INET;
+	address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+	address.sin_port = htons((uint16_t)port);
+	if (bind(socket_handle, (sockaddr*)&address, sizeof(address)) != 0 || listen(socket_handle, 1) != 0) {
+		printf("GDB: cannot listen on port %d\n", port);
+		close_socket(socket_handle);
+		return false;
+	}
+	SetNonBlocking(socket_handle);
+	listener = socket_handle;
+	printf("GDB: listening on localhost:%d\n", port);
+	return true;
+}
+
+void SimGdb::Close()
+{
+	if (client != -1) { Detach(); }
+	if (listener != -1) {
+		close_socket(listener);
+		listener = -1;
+	}
+}
+
+void SimGdb::Poll()
+{
+	if (listener == -1) { return; }
+	if (client == -1) {
+		Accept();
+		if (client == -1) { return; }
+	}
+	if (state == Running && breakpoints->hit) { HandleHit(); }
+	Receive();
+	// Packets wait until the target stops, GDB does not send more than an interrupt while it runs
+	while (client != -1 && state == Stopped && !pending.empty()) {
+		std::string packet = pending.front();
+		pending.erase(pending.begin());
+		Handle(packet);
+	}
+}
+
+void SimGdb::Accept()
+{
+	intptr_t socket_handle = (intptr_t)accept(listener, NULL, NULL);
+	if (socket_handle == -1) { return; }
+	SetNonBlocking(socket_handle);
+	int nodelay = 1;
+	setsockopt(socket_handle, IPPROTO_TCP, TCP_NODELAY, (const char*)&nodelay, sizeof(nodelay));
+	client = socket_handle;
+	input.clear();
+	pending.clear();
+	last_fetch_valid = false;
+	resume = target.running();
+	console.AddLog("GDB: connected");
+	// GDB expects a stopped target on attach
+	report_stop = false;
+	state = Running;
+	Halt(signal_trap);
+}
+
+void SimGdb::Detach()
+{
+	for (auto& breakpoint : inserted) { Release(breakpoint); }
+	inserted.clear();
+	breakpoints->SetStep(false);
+	close_socket(client);
+	client = -1;
+	state = Detached;
+	watch_pending = false;
+	target.run(resume);
+	console.AddLog("GDB: disconnected");
+}
+
+void SimGdb::Release(const Inserted& breakpoint)
+{
+	int index = breakpoints->Find(breakpoint.type, breakpoint.address);
+	if (breakpoint.was_disabled) { breakpoints->SetEnabled(index, false); }
+	else { breakpoints->Remove(index); }
+}
+
+void SimGdb::Receive()
+{
+	char buffer[4096];
+	while (client != -1) {
+		int count = recv(client, buffer, sizeof(buffer), 0);
+		if (count == 0 || (count < 0 && !WouldBlock())) {
+			Detach();
+			return;
+		}
+		if (count < 0) { return; }
+
+		for (int i = 0; i < count; i++) {
+			char c = buffer[i];
+			if (input.empty()) {
+				// Between packets only an interrupt or start of packet matters, acks are ignored
+				if (c == 0x03 && state == Running) { Halt(signal_int); }
+				else if (c == '$') { input += c; }
+				continue;
+			}
+			input += c;
+			// $data#cc
+			size_t length = input.size();
+			if (length >= 4 && input[length - 3] == '#') {
+				std::string data = input.substr(1, length - 4);
+				uint8_t sum = 0;
+				for (char d : data) { sum += (uint8_t)d; }
+				int expected = HexValue(input[length - 2]) << 4 | HexValue(input[length - 1]);
+				input.clear();
+				if (expected != sum) {
+					SendRaw("-", 1);
+					continue;
+				}
+				SendRaw("+", 1);
+				pending.push_back(data);
+			}
+		}
+	}
+}
+
+// Stops at the next opcode fetch
+void SimGdb::Halt(int signal)
+{
+	stop_signal = signal;
+	breakpoints->SetStep(true);
+	target.run(true);
+}
+
+void SimGdb::Resume(bool step)
+{
+	stop_signal = signal_trap;
+	report_stop = true;
+	watch_pending = false;
+	// A prefix at the stop PC only continues into the next fetch when stepping
+	last_fetch_valid = step;
+	breakpoints->SetStep(step);
+	state = Running;
+	target.run(true);
+}
+
+void SimGdb::HandleHit()
+{
+	breakpoints->hit = false;
+	if (breakpoints->hit_type != SimBreakpoint_Exec) {
+		// Watchpoint, let the accessing instruction finish and stop before the next one
+		watch_pending = true;
+		watch_type = breakpoints->hit_type;
+		watch_address = breakpoints->hit_address;
+		breakpoints->SetStep(true);
+		target.run(true);
+		return;
+	}
+
+	uint16_t pc = breakpoints->hit_address;
+	if (breakpoints->hit_step && last_fetch_valid && pc == (uint16_t)(last_fetch + 1) && SimZ80Disasm::IsPrefix(target.read_memory(last_fetch))) {
+		// Opcode after a prefix, the same instruction
+		last_fetch = pc;
+		target.run(true);
+		return;
+	}
+
+	breakpoints->SetStep(false);
+	target.settle();
+	breakpoints->hit = false;
+	target.run(false);
+	stop_pc = pc;
+	last_fetch = pc;
+	last_fetch_valid = true;
+	state = Stopped;
+	if (report_stop) { Send(StopReply()); }
+	report_stop = false;
+}
+
+std::string SimGdb::StopReply()
+{
+	std::string reply = "T";
+	AppendByte(reply, (uint8_t)stop_signal);
+	if (watch_pending) {
+		reply += watch_type == SimBreakpoint_RamRead ? "rwatch:" : "watch:";
+		AppendByte(reply, watch_address >> 8);
+		AppendByte(reply, watch_address & 0xFF);
+		reply += ";";
+	}
+	return reply;
+}
+
+void SimGdb::Handle(const std::string& packet)
+{
+	if (packet.empty()) {
+		Send("");
+		return;
+	}
+	const char* args = packet.c_str() + 1;
+	switch (packet[0]) {
+	case '?':
+		Send(StopReply());
+		return;
+
+	case 'g': {
+		uint16_t registers[SimGdb_RegisterCount];
+		target.read_registers(registers);
+		registers[SimGdb_PC] = stop_pc;
+		std::string reply;
+		for (int r = 0; r < SimGdb_RegisterCount; r++) {
+			AppendByte(reply, registers[r] & 0xFF);
+			AppendByte(reply, registers[r] >> 8);
+		}
+		Send(reply);
+		return;
+	}
+
+	case 'p': {
+		int index = (int)strtoul(args, NULL, 16);
+		if (index >= SimGdb_RegisterCount) {
+			Send("E01");
+			return;
+		}
+		uint16_t registers[SimGdb_RegisterCount];
+		target.read_registers(registers);
+		registers[SimGdb_PC] = stop_pc;
+		std::string reply;
+		AppendByte(reply, registers[index] & 0xFF);
+		AppendByte(reply, registers[index] >> 8);
+		Send(reply);
+		return;
+	}
+
+	case 'G':
+	case 'P':
+		// Registers live inside the model mid-fetch, writing them is not supported
+		Send("E01");
+		return;
+
+	case 'm': {
+		char* end;
+		uint32_t address = strtoul(args, &end, 16);
+		int length = *end == ',' ? (int)strtoul(end + 1, NULL, 16) : 0;
+		if (length > max_memory) { length = max_memory; }
+		std::string reply;
+		for (int i = 0; i < length; i++) { AppendByte(reply, target.read_memory((uint16_t)(address + i))); }
+		Send(reply);
+		return;
+	}
+
+	case 'M': {
+		char* end;
+		uint32_t address = strtoul(args, &end, 16);
+		int length = *end == ',' ? (int)strtoul(end + 1, &end, 16) : 0;
+		const char* data = *end == ':' ? end + 1 : NULL;
+		if (!data || (int)strlen(data) < length * 2) {
+			Send("E01");
+			return;
+		}
+		bool written = true;
+		for (int i = 0; i < length; i++) {
+			uint8_t value = (uint8_t)(HexValue(data[i * 2]) << 4 | HexValue(data[i * 2 + 1]));
+			written &= target.write_memory((uint16_t)(address + i), value);
+		}
+		Send(written ? "OK" : "E01");
+		return;
+	}
+
+	case 'c':
+		Resume(false);
+		return;
+
+	case 's':
+		Resume(true);
+		return;
+
+	case 'Z':
+	case 'z':
+		Send(Breakpoint(packet, packet[0] == 'Z') ? "OK" : "");
+		return;
+
+	case 'H':
+		Send("OK");
+		return;
+
+	case 'D':
+		Send("OK");
+		Detach();
+		return;
+
+	case 'k':
+		Detach();
+		return;
+
+	case 'q':
+		if (packet.compare(0, 10, "qSupported") == 0) {
+			char reply[64];
+			snprintf(reply, sizeof(reply), "PacketSize=%x;qXfer:features:read+", max_memory * 2 + 16);
+			Send(reply);
+		}
+		else if (packet == "qAttached") { Send("1"); }
+		else if (packet == "qC") { Send("QC1"); }
+		else if (packet == "qfThreadInfo") { Send("m1"); }
+		else if (packet == "qsThreadInfo") { Send("l"); }
+		else if (packet.compare(0, 31, "qXfer:features:read:target.xml:") == 0) {
+			// offset,length into the description
+			char* end;
+			size_t offset = strtoul(packet.c_str() + 31, &end, 16);
+			size_t length = *end == ',' ? strtoul(end + 1, NULL, 16) : 0;
+			size_t size = strlen(target_xml);
+			if (offset >= size) { Send("l"); }
+			else {
+				std::string chunk(target_xml + offset, size - offset < length ? size - offset : length);
+				Send((offset + chunk.size() >= size ? "l" : "m") + chunk);
+			}
+		}
+		else { Send(""); }
+		return;
+
+	default:
+		// Unsupported packets get an empty reply, vCont included so GDB falls back to c and s
+		Send("");
+		return;
+	}
+}
+
+// Z/z type,address,kind: 0/1 execute, 2 write, 3 read, 4 access, kind is the length for watchpoints
+bool SimGdb::Breakpoint(const std::string& packet, bool insert)
+{
+	char* end;
+	int type = (int)strtoul(packet.c_str() + 1, &end, 16);
+	if (*end != ',') { return false; }
+	uint32_t address = strtoul(end + 1, &end, 16);
+	int length = *end == ',' ? (int)strtoul(end + 1, NULL, 16) : 1;
+	if (type > 4) { return false; }
+	if (type <= 1 || length < 1) { length = 1; }
+	if (length > 256) { length = 256; }
+
+	SimBreakpoint_Type types[2];
+	int type_count = 0;
+	if (type <= 1) { types[type_count++] = SimBreakpoint_Exec; }
+	if (type == 2 || type == 4) { types[type_count++] = SimBreakpoint_RamWrite; }
+	if (type == 3 || type == 4) { types[type_count++] = SimBreakpoint_RamRead; }
+
+	for (int t = 0; t < type_count; t++) {
+		for (int i = 0; i < length; i++) {
+			uint16_t a = (uint16_t)(address + i);
+			if (insert) {
+				int index = breakpoints->Find(types[t], a);
+				if (index >= 0 && breakpoints->Get(index).enabled) { continue; }
+				Inserted breakpoint = { types[t], a, index >= 0 };
+				inserted.push_back(breakpoint);
+				breakpoints->Add(types[t], a);
+			}
+			else {
+				for (size_t b = 0; b < inserted.size(); b++) {
+					if (inserted[b].type == types[t] && inserted[b].address == a) {
+						Release(inserted[b]);
+						inserted.erase(inserted.begin() + b);
+						break;
+					}
+				}
+			}
+		}
+	}
+	return true;
+}
+
+void SimGdb::Send(const std::string& data)
+{
+	uint8_t sum = 0;
+	for (char c : data) { sum += (uint8_t)c; }
+	std::string packet = "$" + data + "#";
+	AppendByte(packet, sum);
+	SendRaw(packet.c_str(), (int)packet.size());
+}
+
+void SimGdb::SendRaw(const char* data, int length)
+{
+	// Replies are small and local, retry rather than queue when the socket is briefly full
+	while (client != -1 && length > 0) {
+		int sent = send(client, data, length, 0);
+		if (sent < 0) {
+			if (WouldBlock()) { continue; }
+			Detach();
+			return;
+		}
+		data += sent;
+		length -= sent;
+	}
+}
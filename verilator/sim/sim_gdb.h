@@ -0,0 +1,81 @@
+#pragma once
+#include <stdint.h>
+#include <string>
+#include <vector>
+#include "sim_breakpoints.h"
+
+// Registers in the order GDB's z80 target expects them, all 16-bit
+enum SimGdb_Register {
+	SimGdb_AF, SimGdb_BC, SimGdb_DE, SimGdb_HL, SimGdb_SP, SimGdb_PC, SimGdb_IX, SimGdb_IY,
+	SimGdb_AF2, SimGdb_BC2, SimGdb_DE2, SimGdb_HL2, SimGdb_IR,
+	SimGdb_RegisterCount
+};
+
+// Model access supplied by the harness
+struct SimGdb_Target {
+public:
+	void (*read_registers)(uint16_t* registers);	// SimGdb_RegisterCount values
+	uint8_t (*read_memory)(uint16_t address);
+	bool (*write_memory)(uint16_t address, uint8_t value);	// False where the address is not writable
+	void (*run)(bool run);			// Resume or pause the sim loop
+	bool (*running)();				// Sim loop state, restored when GDB detaches
+	void (*settle)();				// Run on from the start of a fetch until the last instruction's results are written back
+};
+
+// GDB remote serial protocol server for the simulated Z80 on a local TCP port
+// Poll is called once per main loop pass and never blocks, the sim runs at full speed while GDB waits for a stop.
+// Every stop lands on an opcode fetch: breakpoints are SimBreakpoints PC entries, watchpoints let the accessing
+// instruction finish, and single step / interrupt use SimBreakpoints::step. Use "set architecture z80" in GDB.
+struct SimGdb {
+public:
+
+	SimGdb(SimBreakpoints* breakpoints, SimGdb_Target target);
+	~SimGdb();
+	bool Listen(int port);
+	void Close();
+	void Poll();
+	bool Connected() { return client != -1; }
+
+private:
+	enum State { Detached, Running, Stopped };
+
+	// Breakpoints GDB set where there was none or only a disabled one, others belong to the user and are left alone
+	struct Inserted {
+		SimBreakpoint_Type type;
+		uint16_t address;
+		bool was_disabled;
+	};
+
+	SimBreakpoints* breakpoints;
+	SimGdb_Target target;
+	intptr_t listener;
+	intptr_t client;
+	State state;
+	bool resume;					// Sim was running when GDB attached
+
+	std::string input;				// Bytes received but not yet framed
+	std::vector<std::string> pending;	// Complete packets, answered while stopped
+	std::vector<Inserted> inserted;	// Breakpoints added by GDB, removed on detach
+
+	uint16_t stop_pc;
+	int stop_signal;
+	bool report_stop;				// GDB is waiting on c or s, the attach halt is answered by ? instead
+	bool watch_pending;
+	SimBreakpoint_Type watch_type;
+	uint16_t watch_address;
+	bool last_fetch_valid;
+	uint16_t last_fetch;
+
+	void Accept();
+	void Detach();
+	void Release(const Inserted& breakpoint);
+	void Receive();
+	void HandleHit();
+	void Halt(int signal);
+	void Resume(bool step);
+	void Handle(const std::string& packet);
+	void Send(const std::string& data);
+	void SendRaw(const char* data, int length);
+	std::string StopReply();
+	bool Breakpoint(const std::string& packet, bool insert);
+};
@@ -585,7 +585,7 @@ void SimInput::Read() {
 			unsigned int ext = ev2ps2[k] & EXT;
 			//fprintf(stderr, "ev2ps2[k] = %x  ext = %x  temp = %x\n", ev2ps2[k], ext, EXT | 0x6b);
 			SimInput_PS2KeyEvent evt = SimInput_PS2KeyEvent(k, m_keyboardState[k], ext, ev2ps2[k]);
-			keyEvents.push(evt);
+			QueueKeyEvent(evt, keyEventWait);
 		}
 		m_keyboardState_last[k] = m_keyboardState[k];
 	}
@@ -594,7 +594,7 @@ void SimInput::Read() {
 		if (m_keyboardState_last[k] != m_keyboardState[k]) {
 			bool ext = 0;
 			SimInput_PS2KeyEvent evt = SimInput_PS2KeyEvent(k, m_keyboardState[k], ext, ev2ps2[k]);
-			keyEvents.push(evt);
+			QueueKeyEvent(evt, keyEventWait);
 		}
 		m_keyboardState_last[k] = m_keyboardState[k];
 	}
@@ -622,37 +622,59 @@ void SimInput::CleanUp() {
 
 unsigned int ps2_key_temp;
 bool ps2_clock = 1;
+vluint64_t key_last_time = 0;
+vluint64_t key_sequence = 0;
 
+void SimInput::QueueKeyEvent(SimInput_PS2KeyEvent evt, unsigned int wait)
+{
+	// Follow the last queued event by wait cycles, or send now if the queue has drained
+	vluint64_t now = sim_time ? *sim_time : 0;
+	vluint64_t time = key_last_time + wait;
+	if (keyEvents.empty() && time < now) { time = now; }
+	ScheduleKeyEvent(evt, time);
+}
 
-void SimInput::BeforeEval()
+void SimInput::ScheduleKeyEvent(SimInput_PS2KeyEvent evt, vluint64_t time)
 {
-	if (keyEventTimer == 0) {
+	evt.time = time;
+	evt.sequence = key_sequence++;
+	keyEvents.push(evt);
+	if (time > key_last_time) { key_last_time = time; }
+	if (time < next_key_time) { next_key_time = time; }
+}
 
-		if (keyEvents.size() > 0) {
-			// Get chunk from queue
-			SimInput_PS2KeyEvent evt = keyEvents.front();
-			keyEvents.pop();
+void SimInput::ClearKeyEvents()
+{
+	while (!keyEvents.empty()) { keyEvents.pop(); }
+	key_last_time = 0;
+	next_key_time = ~(vluint64_t)0;
+}
 
-			//ps2_key_temp = ev2ps2[evt.code];
-			ps2_key_temp = evt.mapped;
-			/*fprintf(stderr, "evt = %x  ext = %d key = %d \n", evt.code, evt.extended, evt.mapped);*/
+void SimInput::BeforeEval(vluint64_t time)
+{
+	// Send one event per eval so the core sees every ps2_key change
+	if (!keyEvents.empty() && keyEvents.top().time <= time) {
+		SimInput_PS2KeyEvent evt = keyEvents.top();
+		keyEvents.pop();
+
+		//ps2_key_temp = ev2ps2[evt.code];
+		ps2_key_temp = evt.mapped;
+		/*fprintf(stderr, "evt = %x  ext = %d key = %d \n", evt.code, evt.extended, evt.mapped);*/
 
-			if (evt.extended) { ps2_key_temp |= (1UL << 8); }
-			if (evt.pressed) { ps2_key_temp |= (1UL << 9); }
-			if (ps2_clock) { ps2_key_temp |= (1UL << 10); }
+		if (evt.extended) { ps2_key_temp |= (1UL << 8); }
+		if (evt.pressed) { ps2_key_temp |= (1UL << 9); }
+		if (ps2_clock) { ps2_key_temp |= (1UL << 10); }
 
-			ps2_clock = !ps2_clock;
+		ps2_clock = !ps2_clock;
 
-			if (ps2_key != NULL) {
-				*ps2_key = ps2_key_temp;
-			}
-			
-			keyEventTimer = keyEventWait;
+		if (ps2_key != NULL) {
+			*ps2_key = ps2_key_temp;
 		}
 	}
-	else {
-		keyEventTimer--;
-	}
+
+	// Events due at the same time go out on following cycles
+	if (keyEvents.empty()) { next_key_time = ~(vluint64_t)0; }
+	else { next_key_time = keyEvents.top().time > time ? keyEvents.top().time : time + 1; }
 }
 
 SimInput::SimInput(int count, DebugConsole c)
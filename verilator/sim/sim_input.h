@@ -16,12 +16,22 @@ public:
 	bool pressed;
 	bool extended;
 	unsigned int mapped;
+	vluint64_t time;		// Sim time (clk_sys cycles) the event is sent to the core
+	vluint64_t sequence;	// Keeps events with the same time in queue order
 
 	SimInput_PS2KeyEvent(char code, bool pressed, bool extended, unsigned int mapped) {
 		this->code = code;
 		this->pressed = pressed;
 		this->extended = extended;
 		this->mapped = mapped;
+		this->time = 0;
+		this->sequence = 0;
+	}
+};
+
+struct SimInput_PS2KeyEventLater {
+	bool operator()(const SimInput_PS2KeyEvent& a, const SimInput_PS2KeyEvent& b) const {
+		return a.time > b.time || (a.time == b.time && a.sequence > b.sequence);
 	}
 };
 
@@ -33,9 +43,12 @@ public:
 	int mappings[16];
 
 	SData* ps2_key = NULL;
-	std::queue<SimInput_PS2KeyEvent> keyEvents;
-	unsigned int keyEventTimer = 0;
-	unsigned int keyEventWait = 50000;
+	vluint64_t* sim_time = NULL;
+
+	// Key events are scheduled at absolute sim times, BeforeEval only needs calling once next_key_time is reached
+	std::priority_queue<SimInput_PS2KeyEvent, std::vector<SimInput_PS2KeyEvent>, SimInput_PS2KeyEventLater> keyEvents;
+	vluint64_t next_key_time = ~(vluint64_t)0;
+	unsigned int keyEventWait = 50000;		// Default spacing between queued events
 
 #define NONE         0xFF
 #define LCTRL        0x000100
@@ -59,7 +72,10 @@ public:
 	int Initialise();
 	void CleanUp();
 	void SetMapping(int index, int code);
-	void BeforeEval(void);
+	void QueueKeyEvent(SimInput_PS2KeyEvent evt, unsigned int wait);
+	void ScheduleKeyEvent(SimInput_PS2KeyEvent evt, vluint64_t time);
+	void ClearKeyEvents();
+	void BeforeEval(vluint64_t time);
 	SimInput(int count, DebugConsole c);
 	~SimInput();
 };
@@ -0,0 +1,82 @@
+#include "sim_input_movie.h"
+
+#include <string.h>
+
+SimInputMovie::SimInputMovie()
+{
+	recording = false;
+	changes = 0;
+	file = NULL;
+	button_count = 0;
+	last_cycle = 0;
+	last_inputs = 0;
+}
+
+SimInputMovie::~SimInputMovie()
+{
+	StopRecording();
+}
+
+bool SimInputMovie::StartRecording(const char* filename, int buttonCount)
+{
+	StopRecording();
+	file = fopen(filename, "wb");
+	if (!file) {
+		printf("Input movie: cannot create %s\n", filename);
+		return false;
+	}
+	this->filename = filename;
+	button_count = buttonCount;
+
+	uint8_t header[16];
+	memcpy(header, SIM_INPUT_MOVIE_MAGIC, 8);
+	for (int i = 0; i < 4; i++) {
+		header[8 + i] = (SIM_INPUT_MOVIE_VERSION >> (i * 8)) & 0xFF;
+		header[12 + i] = (button_count >> (i * 8)) & 0xFF;
+	}
+	fwrite(header, 1, sizeof(header), file);
+
+	changes = 0;
+	last_cycle = 0;
+	last_inputs = 0;
+	recording = true;
+	return true;
+}
+
+void SimInputMovie::Record(uint64_t cycle, uint16_t inputs)
+{
+	if (!recording || inputs == last_inputs) { return; }
+
+	uint8_t record[12];
+	int length = 0;
+	uint64_t delta = cycle - last_cycle;
+	do {
+		uint8_t b = delta & 0x7F;
+		delta >>= 7;
+		record[length++] = b | (delta ? 0x80 : 0);
+	} while (delta);
+	record[length++] = inputs & 0xFF;
+	record[length++] = inputs >> 8;
+	fwrite(record, 1, length, file);
+
+	last_cycle = cycle;
+	last_inputs = inputs;
+	changes++;
+}
+
+void SimInputMovie::Restart()
+{
+	// Cycle stamps are relative to reset, so a reset starts the movie again
+	if (!recording) { return; }
+	std::string name = filename;
+	StartRecording(name.c_str(), button_count);
+}
+
+void SimInputMovie::StopRecording()
+{
+	if (!recording) { return; }
+	fclose(file);
+	file = NULL;
+	recording = false;
+	printf("Input movie: %s, %u changes\n", filename.c_str(), changes);
+}
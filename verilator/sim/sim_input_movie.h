@@ -0,0 +1,37 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string>
+
+// Input movie format
+// ------------------
+// Header: "BBCBCMOV", uint32 version, uint32 button count (little endian)
+// Then one record per change of the inputs vector:
+//   LEB128 varint of clk_sys cycles since the previous record (or since reset for the first)
+//   uint16 new inputs value (little endian)
+// Played back through SimInputScript::LoadMovie.
+
+#define SIM_INPUT_MOVIE_MAGIC "BBCBCMOV"
+#define SIM_INPUT_MOVIE_VERSION 1
+
+struct SimInputMovie {
+public:
+
+	bool recording;
+	uint32_t changes;
+
+	SimInputMovie();
+	~SimInputMovie();
+	bool StartRecording(const char* filename, int buttonCount);
+	void Record(uint64_t cycle, uint16_t inputs);
+	void Restart();
+	void StopRecording();
+
+private:
+	FILE* file;
+	std::string filename;
+	int button_count;
+	uint64_t last_cycle;
+	uint16_t last_inputs;
+};
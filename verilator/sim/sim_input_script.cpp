@@ -0,0 +1,190 @@
+#include "sim_input_script.h"
+#include "sim_input_movie.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <limits.h>
+#include <string.h>
+#include <fstream>
+#include <sstream>
+
+SimInputScript::SimInputScript()
+{
+	active = false;
+	quit_requested = false;
+	inputs = 0;
+	next = 0;
+	next_cycle = UINT64_MAX;
+	next_frame = INT_MAX;
+}
+
+SimInputScript::~SimInputScript()
+{
+
+}
+
+void SimInputScript::SetButtonName(int index, const char* name)
+{
+	if (index < 0 || index > 15) { return; }
+	if ((int)button_names.size() <= index) { button_names.resize(index + 1); }
+	button_names[index] = name;
+}
+
+int SimInputScript::FindButton(const std::string& name)
+{
+	for (size_t i = 0; i < button_names.size(); i++) {
+		if (button_names[i] == name) { return (int)i; }
+	}
+	char* end;
+	long index = strtol(name.c_str(), &end, 10);
+	if (*end == 0 && index >= 0 && index < 16) { return (int)index; }
+	return -1;
+}
+
+bool SimInputScript::Load(const char* filename)
+{
+	std::ifstream reader(filename);
+	if (!reader.is_open()) {
+		printf("Input script: cannot open %s\n", filename);
+		return false;
+	}
+
+	events.clear();
+	std::string line;
+	int line_number = 0;
+	while (std::getline(reader, line)) {
+		line_number++;
+		size_t comment = line.find('#');
+		if (comment != std::string::npos) { line.erase(comment); }
+
+		std::stringstream ss(line);
+		std::string stamp, action, button;
+		if (!(ss >> stamp)) { continue; }
+		ss >> action >> button;
+
+		SimInputScript_Event evt;
+		evt.frame_stamp = stamp[0] == 'f';
+		evt.mask = 0;
+		evt.press = false;
+		evt.quit = false;
+		char* end;
+		evt.time = strtoull(stamp.c_str() + 1, &end, 10);
+		if ((stamp[0] != 'f' && stamp[0] != 'c') || *end != 0) {
+			printf("Input script: %s:%d bad time stamp '%s'\n", filename, line_number, stamp.c_str());
+			return false;
+		}
+
+		if (action == "quit") {
+			evt.quit = true;
+		}
+		else if (action == "press" || action == "release") {
+			int index = FindButton(button);
+			if (index < 0) {
+				printf("Input script: %s:%d unknown button '%s'\n", filename, line_number, button.c_str());
+				return false;
+			}
+			evt.mask = 1 << index;
+			evt.press = action == "press";
+		}
+		else {
+			printf("Input script: %s:%d unknown action '%s'\n", filename, line_number, action.c_str());
+			return false;
+		}
+		events.push_back(evt);
+	}
+
+	active = true;
+	Rewind();
+	printf("Input script: %s, %d events\n", filename, (int)events.size());
+	return true;
+}
+
+bool SimInputScript::LoadMovie(const char* filename)
+{
+	FILE* file = fopen(filename, "rb");
+	if (!file) {
+		printf("Input movie: cannot open %s\n", filename);
+		return false;
+	}
+	uint8_t header[16];
+	if (fread(header, 1, sizeof(header), file) != sizeof(header) || memcmp(header, SIM_INPUT_MOVIE_MAGIC, 8) != 0 || header[8] != SIM_INPUT_MOVIE_VERSION) {
+		printf("Input movie: %s is not a version %d input movie\n", filename, SIM_INPUT_MOVIE_VERSION);
+		fclose(file);
+		return false;
+	}
+
+	// Each change of the inputs vector becomes a press or release event per changed button
+	events.clear();
+	uint64_t cycle = 0;
+	uint16_t state = 0;
+	int c;
+	while ((c = fgetc(file)) != EOF) {
+		uint64_t delta = 0;
+		int shift = 0;
+		while (c & 0x80) {
+			delta |= (uint64_t)(c & 0x7F) << shift;
+			shift += 7;
+			c = fgetc(file);
+			if (c == EOF) { break; }
+		}
+		if (c == EOF) { break; }
+		delta |= (uint64_t)(c & 0x7F) << shift;
+		int lo = fgetc(file);
+		int hi = fgetc(file);
+		if (lo == EOF || hi == EOF) { break; }
+		cycle += delta;
+
+		uint16_t inputs = (uint16_t)(lo | (hi << 8));
+		uint16_t changed = inputs ^ state;
+		for (int b = 0; b < 16; b++) {
+			if (!(changed & (1 << b))) { continue; }
+			SimInputScript_Event evt;
+			evt.frame_stamp = false;
+			evt.time = cycle;
+			evt.mask = 1 << b;
+			evt.press = (inputs >> b) & 1;
+			evt.quit = false;
+			events.push_back(evt);
+		}
+		state = inputs;
+	}
+	fclose(file);
+
+	active = true;
+	Rewind();
+	printf("Input movie: %s, %d events, last at cycle %llu\n", filename, (int)events.size(), (unsigned long long)cycle);
+	return true;
+}
+
+void SimInputScript::Rewind()
+{
+	next = 0;
+	inputs = 0;
+	quit_requested = false;
+	next_cycle = UINT64_MAX;
+	next_frame = INT_MAX;
+	if (active && next < events.size()) {
+		if (events[next].frame_stamp) { next_frame = (int)events[next].time; }
+		else { next_cycle = events[next].time; }
+	}
+}
+
+uint16_t SimInputScript::Apply(uint64_t cycle, int frame)
+{
+	while (next < events.size()) {
+		SimInputScript_Event& evt = events[next];
+		if (evt.frame_stamp ? (uint64_t)frame < evt.time : cycle < evt.time) { break; }
+		if (evt.quit) { quit_requested = true; }
+		else if (evt.press) { inputs |= evt.mask; }
+		else { inputs &= ~evt.mask; }
+		next++;
+	}
+
+	next_cycle = UINT64_MAX;
+	next_frame = INT_MAX;
+	if (next < events.size()) {
+		if (events[next].frame_stamp) { next_frame = (int)events[next].time; }
+		else { next_cycle = events[next].time; }
+	}
+	return inputs;
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+// Scripted input playback
+// -----------------------
+// One event per line, applied in file order once its time stamp has been reached:
+//   f<frame> press|release <button>    frame stamp, applied on the first cycle of that frame
+//   c<cycle> press|release <button>    clk_sys cycle stamp (main_time)
+//   f<frame> quit                      stop a headless run
+// Buttons are names registered with SetButtonName or bit numbers. '#' starts a comment.
+// Binary input movies (sim_input_movie.h) load into the same cycle stamped events.
+
+struct SimInputScript_Event {
+public:
+	bool frame_stamp;
+	uint64_t time;
+	uint16_t mask;
+	bool press;
+	bool quit;
+};
+
+struct SimInputScript {
+public:
+
+	bool active;
+	bool quit_requested;
+	uint16_t inputs;			// Current button state, bit n = button n
+	std::vector<SimInputScript_Event> events;
+	size_t next;
+
+	// Deadline of the next event, the harness only calls Apply once one of these is reached
+	uint64_t next_cycle;
+	int next_frame;
+
+	SimInputScript();
+	~SimInputScript();
+	void SetButtonName(int index, const char* name);
+	bool Load(const char* filename);
+	bool LoadMovie(const char* filename);
+	void Rewind();
+	uint16_t Apply(uint64_t cycle, int frame);
+
+private:
+	std::vector<std::string> button_names;
+	int FindButton(const std::string& name);
+};
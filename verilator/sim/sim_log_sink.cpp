@@ -0,0 +1,248 @@
+#include "sim_log_sink.h"
+
+#include <string.h>
+#include <chrono>
+
+#include "inc/miniz.h"
+
+SimLogSink::SimLogSink()
+{
+	active = false;
+	rotate_bytes = 0;
+	keep_files = 0;
+	compress_segments = false;
+	dropped = 0;
+	bytes_written = 0;
+	segment = 0;
+	ring = NULL;
+	head = 0;
+	tail = 0;
+	stopping = false;
+	format = NULL;
+	file = NULL;
+	file_bytes = 0;
+	dropped_reported = 0;
+	finish_stopping = false;
+}
+
+SimLogSink::~SimLogSink()
+{
+	Close();
+}
+
+bool SimLogSink::Open(const char* base, uint64_t rotateBytes, int keepFiles, bool compressSegments, SimLogSink_Formatter formatter)
+{
+	Close();
+	this->base = base;
+	rotate_bytes = rotateBytes;
+	keep_files = keepFiles;
+	compress_segments = compressSegments;
+	format = formatter;
+	dropped = 0;
+	dropped_reported = 0;
+	bytes_written = 0;
+	segment = 0;
+	if (!OpenSegment()) { return false; }
+
+	ring = new uint8_t[ring_size];
+	head = 0;
+	tail = 0;
+	stopping = false;
+	finished.clear();
+	finish_stopping = false;
+	finisher = std::thread(&SimLogSink::FinisherThread, this);
+	writer = std::thread(&SimLogSink::WriterThread, this);
+	active = true;
+	return true;
+}
+
+void SimLogSink::RingWrite(uint64_t pos, const void* data, uint32_t length)
+{
+	uint32_t start = (uint32_t)(pos & (ring_size - 1));
+	uint32_t first = length < ring_size - start ? length : ring_size - start;
+	memcpy(&ring[start], data, first);
+	memcpy(ring, (const uint8_t*)data + first, length - first);
+}
+
+void SimLogSink::RingRead(uint64_t pos, void* data, uint32_t length)
+{
+	uint32_t start = (uint32_t)(pos & (ring_size - 1));
+	uint32_t first = length < ring_size - start ? length : ring_size - start;
+	memcpy(data, &ring[start], first);
+	memcpy((uint8_t*)data + first, ring, length - first);
+}
+
+bool SimLogSink::Push(uint64_t time, const char* fmt, const void* payload, uint32_t length)
+{
+	if (!active) { return false; }
+
+	// Records are padded to 8 bytes so headers never straddle odd offsets
+	uint32_t size = (uint32_t)((sizeof(Record) + length + 7) & ~7);
+	uint64_t h = head.load(std::memory_order_relaxed);
+	if (h + size - tail.load(std::memory_order_acquire) > ring_size) {
+		dropped.fetch_add(1, std::memory_order_relaxed);
+		return false;
+	}
+
+	Record record;
+	record.length = length;
+	record.reserved = 0;
+	record.time = time;
+	record.fmt = fmt;
+	RingWrite(h, &record, sizeof(record));
+	RingWrite(h + sizeof(record), payload, length);
+	head.store(h + size, std::memory_order_release);
+	return true;
+}
+
+std::string SimLogSink::SegmentName(int index, const char* extension)
+{
+	char name[16];
+	snprintf(name, sizeof(name), ".%03d.", index);
+	return base + name + extension;
+}
+
+bool SimLogSink::OpenSegment()
+{
+	std::string name = SegmentName(segment, "log");
+	file = fopen(name.c_str(), "w");
+	if (!file) {
+		printf("Log file: cannot create %s\n", name.c_str());
+		return false;
+	}
+	setvbuf(file, NULL, _IOFBF, 1 << 16);
+	file_bytes = 0;
+	return true;
+}
+
+// Called on the writer thread, the slow part is left to the finisher
+void SimLogSink::FinishSegment()
+{
+	fclose(file);
+	file = NULL;
+	std::lock_guard<std::mutex> lock(finish_lock);
+	finished.push_back(segment);
+	finish_ready.notify_one();
+}
+
+void SimLogSink::CompressSegment(int index)
+{
+	std::string name = SegmentName(index, "log");
+
+	if (compress_segments) {
+		FILE* in = fopen(name.c_str(), "rb");
+		if (in) {
+			fseek(in, 0, SEEK_END);
+			long size = ftell(in);
+			fseek(in, 0, SEEK_SET);
+			std::vector<uint8_t> data(size > 0 ? size : 0);
+			size_t read = fread(data.data(), 1, data.size(), in);
+			fclose(in);
+			std::string zip = SegmentName(index, "zip");
+			std::string entry = name.substr(name.find_last_of("/\\") + 1);
+			if (mz_zip_add_mem_to_archive_file_in_place(zip.c_str(), entry.c_str(), data.data(), read, NULL, 0, MZ_BEST_SPEED)) {
+				remove(name.c_str());
+			}
+		}
+	}
+
+	// Drop the oldest segment once more than keep_files exist
+	if (keep_files > 0 && index >= keep_files) {
+		remove(SegmentName(index - keep_files, "log").c_str());
+		remove(SegmentName(index - keep_files, "zip").c_str());
+	}
+}
+
+void SimLogSink::FinisherThread()
+{
+	while (true) {
+		int index;
+		{
+			std::unique_lock<std::mutex> lock(finish_lock);
+			finish_ready.wait(lock, [this] { return !finished.empty() || finish_stopping; });
+			if (finished.empty()) { break; }
+			index = finished.front();
+			finished.erase(finished.begin());
+		}
+		CompressSegment(index);
+	}
+}
+
+void SimLogSink::WriterThread()
+{
+	std::vector<uint8_t> payload;
+	char text[1024];
+	while (true) {
+		uint64_t t = tail.load(std::memory_order_relaxed);
+		uint64_t h = head.load(std::memory_order_acquire);
+		// Note lost lines where they were lost
+		uint64_t lost = dropped.load(std::memory_order_relaxed);
+		if (lost != dropped_reported) {
+			int n = fprintf(file, "... %llu lines dropped, log ring full\n", (unsigned long long)(lost - dropped_reported));
+			if (n > 0) {
+				file_bytes += n;
+				bytes_written += n;
+			}
+			dropped_reported = lost;
+		}
+		if (t == h) {
+			if (stopping) { break; }
+			fflush(file);
+			std::this_thread::sleep_for(std::chrono::milliseconds(2));
+			continue;
+		}
+
+		while (t != h) {
+			Record record;
+			RingRead(t, &record, sizeof(record));
+			payload.resize(record.length + 1);
+			RingRead(t + sizeof(record), payload.data(), record.length);
+			payload[record.length] = 0;
+			t += (sizeof(Record) + record.length + 7) & ~7;
+			tail.store(t, std::memory_order_release);
+
+			const char* line = (const char*)payload.data();
+			if (record.fmt && format) {
+				format(record.fmt, payload.data(), text, sizeof(text));
+				line = text;
+			}
+			int n = fprintf(file, "%llu > %s\n", (unsigned long long)record.time, line);
+			if (n > 0) {
+				file_bytes += n;
+				bytes_written += n;
+			}
+
+			if (rotate_bytes > 0 && file_bytes >= rotate_bytes) {
+				FinishSegment();
+				segment++;
+				if (!OpenSegment()) {
+					// Nowhere left to write, discard the rest
+					tail.store(head.load(std::memory_order_acquire), std::memory_order_release);
+					return;
+				}
+			}
+		}
+	}
+}
+
+void SimLogSink::Close()
+{
+	if (!active) { return; }
+	active = false;
+	stopping = true;
+	writer.join();
+	if (file) {
+		// The last segment is left uncompressed so it can be read while the sim is stopped
+		fclose(file);
+		file = NULL;
+	}
+	{
+		std::lock_guard<std::mutex> lock(finish_lock);
+		finish_stopping = true;
+		finish_ready.notify_one();
+	}
+	finisher.join();
+	if (dropped > 0) { printf("Log file: %llu lines dropped\n", (unsigned long long)dropped.load()); }
+	delete[] ring;
+	ring = NULL;
+}
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string>
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <vector>
+
+// Formats a deferred record (see DebugConsole::AddLogDeferred) into out
+typedef void (*SimLogSink_Formatter)(const char* fmt, const uint8_t* record, char* out, int size);
+
+// Asynchronous log file writer
+// Lines are pushed into a single-producer, single-consumer byte ring and written out by a background thread.
+// Pushing never blocks, lines are dropped and counted when the ring is full, and the count is written to the file.
+// Output goes to <base>.000.log, <base>.001.log... starting a new file every rotate_bytes and keeping keep_files
+// finished segments besides the current one. Finished segments can be compressed to <base>.NNN.zip with miniz,
+// on a second thread so the writer keeps draining the ring meanwhile.
+struct SimLogSink {
+public:
+
+	static const uint32_t ring_size = 1 << 22;
+
+	bool active;
+	uint64_t rotate_bytes;
+	int keep_files;
+	bool compress_segments;
+	std::atomic<uint64_t> dropped;
+	std::atomic<uint64_t> bytes_written;
+	std::atomic<int> segment;
+
+	SimLogSink();
+	~SimLogSink();
+	bool Open(const char* base, uint64_t rotateBytes, int keepFiles, bool compressSegments, SimLogSink_Formatter formatter);
+	bool Push(uint64_t time, const char* fmt, const void* payload, uint32_t length);
+	void Close();
+
+private:
+	struct Record {
+		uint32_t length;		// Payload bytes following the header
+		uint32_t reserved;
+		uint64_t time;
+		const char* fmt;		// NULL when the payload is text
+	};
+
+	uint8_t* ring;
+	std::atomic<uint64_t> head;		// Written by producer
+	std::atomic<uint64_t> tail;		// Written by writer thread
+	std::atomic<bool> stopping;
+	std::thread writer;
+	SimLogSink_Formatter format;
+	std::string base;
+	FILE* file;
+	uint64_t file_bytes;
+	uint64_t dropped_reported;
+
+	std::thread finisher;
+	std::mutex finish_lock;
+	std::condition_variable finish_ready;
+	std::vector<int> finished;		// Closed segments waiting for compression and pruning, oldest first
+	bool finish_stopping;
+
+	void RingWrite(uint64_t pos, const void* data, uint32_t length);
+	void RingRead(uint64_t pos, void* data, uint32_t length);
+	std::string SegmentName(int index, const char* extension);
+	bool OpenSegment();
+	void FinishSegment();
+	void CompressSegment(int index);
+	void WriterThread();
+	void FinisherThread();
+};
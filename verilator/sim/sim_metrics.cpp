@@ -0,0 +1,142 @@
+#include "sim_metrics.h"
+
+#include "imgui.h"
+#include "implot.h"
+
+using namespace std::chrono;
+
+SimMetrics::SimMetrics(double clockFrequency, double targetFps)
+{
+	clock_frequency = clockFrequency;
+	target_fps = targetFps;
+	sample_interval = 0.25;
+	epoch = steady_clock::now();
+	Reset();
+}
+
+SimMetrics::~SimMetrics()
+{
+
+}
+
+void SimMetrics::Reset()
+{
+	for (int i = 0; i < history_size; i++) {
+		history_time[i] = 0;
+		history_cycles[i] = 0;
+		history_evals[i] = 0;
+		history_fps[i] = 0;
+		history_target_fps[i] = (float)target_fps;
+		history_gui[i] = 0;
+	}
+	history_pos = 0;
+	history_count = 0;
+
+	cycles_per_second = 0;
+	evals_per_second = 0;
+	frames_per_second = 0;
+	realtime_ratio = 0;
+	gui_frame_time = 0;
+	gui_frame_time_max = 0;
+	gui_frames_per_second = 0;
+	gui_time_share = 0;
+
+	sample_start = steady_clock::now();
+	sample_cycles = 0;
+	sample_evals = 0;
+	sample_frames = 0;
+	gui_time_total = 0;
+	gui_frames = 0;
+}
+
+void SimMetrics::Update(uint64_t cycles, uint64_t evals, int frames)
+{
+	// Simulation was reset, start a new sample from here
+	if (cycles < sample_cycles || frames < sample_frames) {
+		sample_start = steady_clock::now();
+		sample_cycles = cycles;
+		sample_evals = evals;
+		sample_frames = frames;
+		return;
+	}
+
+	steady_clock::time_point now = steady_clock::now();
+	double elapsed = duration<double>(now - sample_start).count();
+	if (elapsed < sample_interval) { return; }
+
+	cycles_per_second = (cycles - sample_cycles) / elapsed;
+	evals_per_second = (evals - sample_evals) / elapsed;
+	frames_per_second = (frames - sample_frames) / elapsed;
+	realtime_ratio = clock_frequency > 0 ? cycles_per_second / clock_frequency : 0;
+	gui_frame_time = gui_frames > 0 ? gui_time_total / gui_frames : 0;
+	gui_frames_per_second = gui_frames / elapsed;
+	gui_time_share = gui_time_total / (elapsed * 1000.0);
+
+	history_time[history_pos] = (float)duration<double>(now - epoch).count();
+	history_cycles[history_pos] = (float)(cycles_per_second / 1000000.0);
+	history_evals[history_pos] = (float)(evals_per_second / 1000000.0);
+	history_fps[history_pos] = (float)frames_per_second;
+	history_target_fps[history_pos] = (float)target_fps;
+	history_gui[history_pos] = (float)gui_frame_time;
+	history_pos++;
+	if (history_pos == history_size) { history_pos = 0; }
+	if (history_count < history_size) { history_count++; }
+
+	sample_start = now;
+	sample_cycles = cycles;
+	sample_evals = evals;
+	sample_frames = frames;
+	gui_time_total = 0;
+	gui_frames = 0;
+}
+
+void SimMetrics::BeginGuiFrame()
+{
+	gui_start = steady_clock::now();
+}
+
+void SimMetrics::EndGuiFrame()
+{
+	double ms = duration<double, std::milli>(steady_clock::now() - gui_start).count();
+	gui_time_total += ms;
+	gui_frames++;
+	if (ms > gui_frame_time_max) { gui_frame_time_max = ms; }
+}
+
+void SimMetrics::Draw(const char* title, bool* p_open, ImVec2 size)
+{
+	ImGui::SetNextWindowSize(size, ImGuiCond_Once);
+	if (!ImGui::Begin(title, p_open))
+	{
+		ImGui::End();
+		return;
+	}
+
+	ImGui::Text("clk_sys: %.3f MHz (%.1f%% of real-time)", cycles_per_second / 1000000.0, realtime_ratio * 100.0);
+	ImGui::Text("evals: %.3f M/s", evals_per_second / 1000000.0);
+	ImGui::Text("emulated FPS: %.2f / %.0f", frames_per_second, target_fps);
+	ImGui::Text("GUI frame: %.2f ms (max %.2f ms) at %.1f Hz, %.1f%% of wall time", gui_frame_time, gui_frame_time_max, gui_frames_per_second, gui_time_share * 100.0);
+	ImGui::SameLine();
+	if (ImGui::SmallButton("Reset max")) { gui_frame_time_max = 0; }
+
+	// History is a ring buffer, oldest sample is at history_pos once it has filled
+	int offset = history_count < history_size ? 0 : history_pos;
+	float plotWidth = ImGui::GetContentRegionAvail().x;
+	if (ImPlot::BeginPlot("Throughput", ImVec2(plotWidth, 160), ImPlotFlags_NoMenus)) {
+		ImPlot::SetupAxes(NULL, "M/s", ImPlotAxisFlags_AutoFit | ImPlotAxisFlags_NoTickLabels, ImPlotAxisFlags_AutoFit);
+		ImPlot::PlotLine("clk_sys cycles", history_time, history_cycles, history_count, offset);
+		ImPlot::PlotLine("evals", history_time, history_evals, history_count, offset);
+		ImPlot::EndPlot();
+	}
+	if (ImPlot::BeginPlot("Frame rate", ImVec2(plotWidth, 160), ImPlotFlags_NoMenus)) {
+		ImPlot::SetupAxes(NULL, "FPS", ImPlotAxisFlags_AutoFit | ImPlotAxisFlags_NoTickLabels, ImPlotAxisFlags_AutoFit);
+		ImPlot::SetupAxis(ImAxis_Y2, "GUI ms", ImPlotAxisFlags_AuxDefault | ImPlotAxisFlags_AutoFit);
+		ImPlot::PlotLine("emulated", history_time, history_fps, history_count, offset);
+		ImPlot::PlotLine("PAL target", history_time, history_target_fps, history_count, offset);
+		ImPlot::SetAxes(ImAxis_X1, ImAxis_Y2);
+		ImPlot::PlotLine("GUI frame", history_time, history_gui, history_count, offset);
+		ImPlot::EndPlot();
+	}
+
+	ImGui::End();
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <chrono>
+#include <stdint.h>
+#include "imgui.h"
+
+struct SimMetrics {
+public:
+
+	static const int history_size = 240;
+	float history_time[history_size];
+	float history_cycles[history_size];		// Simulated clk_sys cycles per second (MHz)
+	float history_evals[history_size];		// Model evals per second (millions)
+	float history_fps[history_size];		// Emulated frames per second
+	float history_target_fps[history_size];
+	float history_gui[history_size];		// GUI frame time (ms)
+	int history_pos;
+	int history_count;
+
+	double cycles_per_second;
+	double evals_per_second;
+	double frames_per_second;
+	double realtime_ratio;
+	double gui_frame_time;
+	double gui_frame_time_max;
+	double gui_frames_per_second;
+	double gui_time_share;			// Fraction of wall time spent building and rendering the GUI
+
+	double clock_frequency;
+	double target_fps;
+	double sample_interval;
+
+	SimMetrics(double clockFrequency, double targetFps);
+	~SimMetrics();
+	void Reset();
+	void Update(uint64_t cycles, uint64_t evals, int frames);
+	void BeginGuiFrame();
+	void EndGuiFrame();
+	void Draw(const char* title, bool* p_open, ImVec2 size);
+
+private:
+	std::chrono::steady_clock::time_point sample_start;
+	std::chrono::steady_clock::time_point gui_start;
+	std::chrono::steady_clock::time_point epoch;
+	uint64_t sample_cycles;
+	uint64_t sample_evals;
+	int sample_frames;
+	double gui_time_total;
+	int gui_frames;
+};
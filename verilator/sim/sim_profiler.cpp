@@ -0,0 +1,207 @@
+#include "sim_profiler.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <algorithm>
+
+// BBC Bridge Companion memory map (system.v)
+static const SimProfiler_Region regions[] = {
+	{ "BIOS", 0x0000, 0x3FFF },
+	{ "Cartridge", 0x4000, 0xBFFF },
+	{ "Unmapped", 0xC000, 0xDFFF },
+	{ "RAM", 0xE000, 0xFFFF },
+};
+static const int region_count = sizeof(regions) / sizeof(regions[0]);
+
+static const double rows_refresh = 0.5;		// Seconds between hot list rebuilds
+
+static void DefaultDisassemble(uint16_t pc, uint32_t opcode, char* out, int size)
+{
+	SimZ80Disasm::Format((opcode >> 16) & 0xFF, (opcode >> 8) & 0xFF, opcode & 0xFF, pc, NULL, 0, out, size);
+}
+
+SimProfiler::SimProfiler()
+{
+	enabled = false;
+	disassemble = DefaultDisassemble;
+	rows_time = -rows_refresh;
+	sort_column = 2;
+	sort_ascending = false;
+	Reset();
+}
+
+SimProfiler::~SimProfiler()
+{
+}
+
+void SimProfiler::Retire(uint16_t pc, uint8_t ir, uint64_t time)
+{
+	if (fetch.Extend(ir)) { return; }
+
+	if (started) {
+		uint64_t elapsed = time - start_time;
+		instructions[start_pc]++;
+		cycles[start_pc] += elapsed;
+		opcodes[start_pc] = fetch.opcode;
+		total_instructions++;
+		total_cycles += elapsed;
+	}
+	started = true;
+	start_pc = pc;
+	start_time = time;
+	fetch.Start(ir);
+}
+
+void SimProfiler::Reset()
+{
+	memset(instructions, 0, sizeof(instructions));
+	memset(cycles, 0, sizeof(cycles));
+	memset(opcodes, 0, sizeof(opcodes));
+	total_instructions = 0;
+	total_cycles = 0;
+	started = false;
+	fetch = SimZ80Disasm_Fetch();
+	start_pc = 0;
+	start_time = 0;
+	rows.clear();
+}
+
+const SimProfiler_Region* SimProfiler::RegionOf(uint16_t pc)
+{
+	for (int r = 0; r < region_count; r++) {
+		if (pc >= regions[r].start && pc <= regions[r].end) { return &regions[r]; }
+	}
+	return NULL;
+}
+
+bool SimProfiler::ExportCSV(const char* filename)
+{
+	FILE* file = fopen(filename, "w");
+	if (!file) {
+		printf("Profiler: cannot create %s\n", filename);
+		return false;
+	}
+	fprintf(file, "pc,region,instructions,cycles,disassembly\n");
+	char text[64];
+	for (int pc = 0; pc < 0x10000; pc++) {
+		if (!instructions[pc]) { continue; }
+		disassemble((uint16_t)pc, opcodes[pc], text, sizeof(text));
+		const SimProfiler_Region* region = RegionOf((uint16_t)pc);
+		fprintf(file, "%04X,%s,%llu,%llu,\"%s\"\n", pc, region ? region->name : "", (unsigned long long)instructions[pc], (unsigned long long)cycles[pc], text);
+	}
+	fclose(file);
+	return true;
+}
+
+void SimProfiler::BuildRows()
+{
+	rows.clear();
+	for (int pc = 0; pc < 0x10000; pc++) {
+		if (!instructions[pc]) { continue; }
+		Row row = { (uint16_t)pc, instructions[pc], cycles[pc] };
+		rows.push_back(row);
+	}
+	SortRows();
+}
+
+void SimProfiler::SortRows()
+{
+	int column = sort_column;
+	bool ascending = sort_ascending;
+	std::sort(rows.begin(), rows.end(), [column, ascending](const Row& a, const Row& b) {
+		uint64_t va, vb;
+		switch (column) {
+		case 2: va = a.instructions; vb = b.instructions; break;
+		case 3: va = a.cycles; vb = b.cycles; break;
+		case 4: va = a.cycles * 1000 / a.instructions; vb = b.cycles * 1000 / b.instructions; break;
+		default: va = a.pc; vb = b.pc; break;
+		}
+		if (va == vb) { return a.pc < b.pc; }
+		return ascending ? va < vb : va > vb;
+	});
+}
+
+void SimProfiler::Draw(const char* title, bool* p_open, ImVec2 size)
+{
+	ImGui::SetNextWindowSize(size, ImGuiCond_Once);
+	if (!ImGui::Begin(title, p_open))
+	{
+		ImGui::End();
+		return;
+	}
+
+	ImGui::Checkbox("Profile", &enabled);
+	ImGui::SameLine();
+	if (ImGui::SmallButton("Reset")) { Reset(); }
+	ImGui::SameLine();
+	if (ImGui::SmallButton("Export CSV")) { ExportCSV("profile.csv"); }
+	ImGui::SameLine();
+	ImGui::Text("%llu instructions, %llu cycles", (unsigned long long)total_instructions, (unsigned long long)total_cycles);
+
+	// Region totals
+	if (ImGui::BeginTable("regions", 3, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingFixedFit)) {
+		ImGui::TableSetupColumn("Region");
+		ImGui::TableSetupColumn("Instructions");
+		ImGui::TableSetupColumn("Cycles");
+		ImGui::TableHeadersRow();
+		for (int r = 0; r < region_count; r++) {
+			uint64_t region_instructions = 0;
+			uint64_t region_cycles = 0;
+			for (int pc = regions[r].start; pc <= regions[r].end; pc++) {
+				region_instructions += instructions[pc];
+				region_cycles += cycles[pc];
+			}
+			ImGui::TableNextRow();
+			ImGui::TableNextColumn(); ImGui::Text("%s %04X-%04X", regions[r].name, regions[r].start, regions[r].end);
+			ImGui::TableNextColumn(); ImGui::Text("%llu (%.1f%%)", (unsigned long long)region_instructions, total_instructions ? region_instructions * 100.0 / total_instructions : 0.0);
+			ImGui::TableNextColumn(); ImGui::Text("%llu (%.1f%%)", (unsigned long long)region_cycles, total_cycles ? region_cycles * 100.0 / total_cycles : 0.0);
+		}
+		ImGui::EndTable();
+	}
+
+	// Hot list, rebuilt periodically rather than every frame
+	if (ImGui::GetTime() - rows_time >= rows_refresh) {
+		BuildRows();
+		rows_time = ImGui::GetTime();
+	}
+	ImGuiTableFlags flags = ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingFixedFit | ImGuiTableFlags_Sortable | ImGuiTableFlags_ScrollY;
+	if (ImGui::BeginTable("hotlist", 6, flags)) {
+		ImGui::TableSetupScrollFreeze(0, 1);
+		ImGui::TableSetupColumn("PC", ImGuiTableColumnFlags_None, 0, 0);
+		ImGui::TableSetupColumn("Region", ImGuiTableColumnFlags_NoSort, 0, 1);
+		ImGui::TableSetupColumn("Instructions", ImGuiTableColumnFlags_DefaultSort | ImGuiTableColumnFlags_PreferSortDescending, 0, 2);
+		ImGui::TableSetupColumn("Cycles", ImGuiTableColumnFlags_PreferSortDescending, 0, 3);
+		ImGui::TableSetupColumn("Cycles/ins", ImGuiTableColumnFlags_PreferSortDescending, 0, 4);
+		ImGui::TableSetupColumn("Disassembly", ImGuiTableColumnFlags_NoSort | ImGuiTableColumnFlags_WidthStretch, 0, 5);
+		ImGui::TableHeadersRow();
+
+		ImGuiTableSortSpecs* specs = ImGui::TableGetSortSpecs();
+		if (specs && specs->SpecsDirty && specs->SpecsCount > 0) {
+			sort_column = specs->Specs[0].ColumnUserID;
+			sort_ascending = specs->Specs[0].SortDirection == ImGuiSortDirection_Ascending;
+			SortRows();
+			specs->SpecsDirty = false;
+		}
+
+		ImGuiListClipper clipper;
+		clipper.Begin((int)rows.size());
+		char text[64];
+		while (clipper.Step()) {
+			for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; i++) {
+				const Row& row = rows[i];
+				const SimProfiler_Region* region = RegionOf(row.pc);
+				disassemble(row.pc, opcodes[row.pc], text, sizeof(text));
+				ImGui::TableNextRow();
+				ImGui::TableNextColumn(); ImGui::Text("%04X", row.pc);
+				ImGui::TableNextColumn(); ImGui::TextUnformatted(region ? region->name : "");
+				ImGui::TableNextColumn(); ImGui::Text("%llu (%.2f%%)", (unsigned long long)row.instructions, total_instructions ? row.instructions * 100.0 / total_instructions : 0.0);
+				ImGui::TableNextColumn(); ImGui::Text("%llu (%.2f%%)", (unsigned long long)row.cycles, total_cycles ? row.cycles * 100.0 / total_cycles : 0.0);
+				ImGui::TableNextColumn(); ImGui::Text("%.1f", (double)row.cycles / row.instructions);
+				ImGui::TableNextColumn(); ImGui::TextUnformatted(text);
+			}
+		}
+		ImGui::EndTable();
+	}
+
+	ImGui::End();
+}
@@ -0,0 +1,62 @@
+#pragma once
+#include <stdint.h>
+#include <vector>
+#include "imgui.h"
+#include "sim_z80_disasm.h"
+
+// Address range the profile is totalled over
+struct SimProfiler_Region {
+public:
+	const char* name;
+	uint16_t start;
+	uint16_t end;			// Inclusive
+};
+
+// Writes the disassembly of the instruction at pc into out, opcode holds the prefix and opcode bytes seen
+// (superext << 16 | ext << 8 | ir)
+typedef void (*SimProfiler_Disassembler)(uint16_t pc, uint32_t opcode, char* out, int size);
+
+// Exact Z80 PC profiler
+// Retire is called as each opcode is fetched, the time since the previous fetch is charged to the previous instruction.
+// Prefix bytes (CB/DD/ED/FD) are folded into the instruction they start.
+struct SimProfiler {
+public:
+
+	bool enabled;
+	SimProfiler_Disassembler disassemble;
+
+	SimProfiler();
+	~SimProfiler();
+	void Retire(uint16_t pc, uint8_t ir, uint64_t time);
+	void Reset();
+	void Restart() { started = false; fetch = SimZ80Disasm_Fetch(); }	// Drop the instruction in flight, the gap while disabled is not charged
+	bool ExportCSV(const char* filename);
+	void Draw(const char* title, bool* p_open, ImVec2 size);
+
+private:
+	struct Row {
+		uint16_t pc;
+		uint64_t instructions;
+		uint64_t cycles;
+	};
+
+	uint64_t instructions[0x10000];
+	uint64_t cycles[0x10000];
+	uint32_t opcodes[0x10000];
+	uint64_t total_instructions;
+	uint64_t total_cycles;
+
+	bool started;
+	SimZ80Disasm_Fetch fetch;
+	uint16_t start_pc;
+	uint64_t start_time;
+
+	std::vector<Row> rows;
+	double rows_time;
+	int sort_column;
+	bool sort_ascending;
+
+	const SimProfiler_Region* RegionOf(uint16_t pc);
+	void BuildRows();
+	void SortRows();
+};
@@ -0,0 +1,99 @@
+#include "sim_resampler.h"
+
+#include <math.h>
+
+const double pi = 3.14159265358979323846;
+
+SimResampler::SimResampler(uint32_t inputRateNum, uint32_t inputRateDen, uint32_t outputRate)
+{
+	output_rate = outputRate;
+	step = inputRateNum;
+	period = (uint64_t)inputRateDen * outputRate;
+
+	// Low pass at 45% of the lower rate, kernel width scales with the input/output ratio when decimating
+	double input_rate = (double)inputRateNum / inputRateDen;
+	double cutoff = 0.45 * (input_rate < outputRate ? input_rate : outputRate) / input_rate;
+	half = (int)ceil(zero_crossings / (2.0 * cutoff));
+	taps = half * 2;
+
+	// Row p holds the kernel for an output time p/phases of an input sample after input index pos
+	coeffs.resize(phases * taps);
+	for (int p = 0; p < phases; p++) {
+		std::vector<double> row(taps);
+		double sum = 0;
+		for (int k = 0; k < taps; k++) {
+			double x = (k - half + 1) - (double)p / phases;
+			double s = x == 0 ? 1.0 : sin(pi * 2.0 * cutoff * x) / (pi * 2.0 * cutoff * x);
+			double w = 0.42 + 0.5 * cos(pi * x / half) + 0.08 * cos(2.0 * pi * x / half);
+			if (fabs(x) >= half) { w = 0; }
+			row[k] = s * w;
+			sum += row[k];
+		}
+		// Normalise each phase to unity DC gain
+		for (int k = 0; k < taps; k++) {
+			coeffs[p * taps + k] = (int16_t)lround(row[k] / sum * 32767.0);
+		}
+	}
+	Reset();
+}
+
+SimResampler::~SimResampler()
+{
+
+}
+
+void SimResampler::Reset()
+{
+	frames_in = 0;
+	frames_out = 0;
+	frac = 0;
+	// Prime with silence so the first output has a full window of history
+	input_l.assign(half - 1, 0);
+	input_r.assign(half - 1, 0);
+	pos = half - 1;
+}
+
+void SimResampler::Push(int16_t left, int16_t right)
+{
+	input_l.push_back(left);
+	input_r.push_back(right);
+	frames_in++;
+}
+
+int SimResampler::Process(int16_t* output, int maxFrames)
+{
+	int frames = 0;
+	while (frames < maxFrames && pos + half < input_l.size()) {
+		const int16_t* c = &coeffs[(size_t)((frac * phases) / period) * taps];
+		const int16_t* l = &input_l[pos - half + 1];
+		const int16_t* r = &input_r[pos - half + 1];
+		int64_t acc_l = 0;
+		int64_t acc_r = 0;
+		for (int k = 0; k < taps; k++) {
+			acc_l += (int32_t)l[k] * c[k];
+			acc_r += (int32_t)r[k] * c[k];
+		}
+		acc_l = (acc_l + (1 << 14)) >> 15;
+		acc_r = (acc_r + (1 << 14)) >> 15;
+		output[frames * 2] = (int16_t)(acc_l > 32767 ? 32767 : acc_l < -32768 ? -32768 : acc_l);
+		output[frames * 2 + 1] = (int16_t)(acc_r > 32767 ? 32767 : acc_r < -32768 ? -32768 : acc_r);
+		frames++;
+
+		// Advance output time by inputRate / outputRate input samples
+		frac += step;
+		while (frac >= period) {
+			frac -= period;
+			pos++;
+		}
+	}
+	frames_out += frames;
+
+	// Drop input that no future output window can reach
+	size_t consumed = pos - half + 1;
+	if (consumed > 0 && consumed <= input_l.size()) {
+		input_l.erase(input_l.begin(), input_l.begin() + consumed);
+		input_r.erase(input_r.begin(), input_r.begin() + consumed);
+		pos -= consumed;
+	}
+	return frames;
+}
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <vector>
+
+// Streaming stereo polyphase resampler with a rational input rate (inputRateNum / inputRateDen Hz).
+// Output timing is tracked with an exact integer phase accumulator, so long runs produce exactly
+// outputRate samples per second of simulated time with no drift. The windowed-sinc kernel is
+// quantised to a fixed number of phases and applied in Q15 fixed point.
+struct SimResampler {
+public:
+
+	static const int phases = 256;
+	static const int zero_crossings = 8;
+
+	uint32_t output_rate;
+	uint64_t frames_in;
+	uint64_t frames_out;
+
+	SimResampler(uint32_t inputRateNum, uint32_t inputRateDen, uint32_t outputRate);
+	~SimResampler();
+	void Reset();
+	void Push(int16_t left, int16_t right);
+	int Process(int16_t* output, int maxFrames);		// Interleaved stereo, returns frames written
+
+private:
+	uint64_t step;			// Input rate numerator added per output sample
+	uint64_t period;		// Phase accumulator wraps at inputRateDen * outputRate
+	uint64_t frac;
+	int taps;
+	int half;
+	std::vector<int16_t> coeffs;		// phases rows of taps coefficients
+	std::vector<int16_t> input_l;
+	std::vector<int16_t> input_r;
+	size_t pos;				// Input index of the sample at or before the next output time
+};
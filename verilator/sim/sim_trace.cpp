@@ -0,0 +1,422 @@
+#include "sim_trace.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <ctype.h>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#ifndef _MSC_VER
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#else
+#define WIN32
+#include <windows.h>
+#endif
+
+static const char trace_magic[8] = { 'B', 'B', 'C', 'B', 'C', 'T', 'R', 'C' };
+static const uint32_t trace_version = 1;
+
+static_assert(sizeof(SimTraceRecord) == 40, "SimTraceRecord layout changed");
+
+uint32_t SimTrace_Hash(const char* text, size_t length)
+{
+	// FNV-1a over the lowercased text
+	uint32_t hash = 2166136261u;
+	for (size_t i = 0; i < length; i++) {
+		hash ^= (uint8_t)tolower((unsigned char)text[i]);
+		hash *= 16777619u;
+	}
+	return hash;
+}
+
+static int HexValue(char c)
+{
+	if (c >= '0' && c <= '9') { return c - '0'; }
+	if (c >= 'a' && c <= 'f') { return c - 'a' + 10; }
+	if (c >= 'A' && c <= 'F') { return c - 'A' + 10; }
+	return -1;
+}
+
+static bool SetRegister(SimTraceRecord& record, const char* name, size_t length, uint32_t value)
+{
+	char n[4] = { 0 };
+	if (length > 3) { return false; }
+	for (size_t i = 0; i < length; i++) { n[i] = (char)toupper((unsigned char)name[i]); }
+
+	if (!strcmp(n, "A")) { record.a = (uint8_t)value; record.valid |= SimTrace_A; }
+	else if (!strcmp(n, "F")) { record.f = (uint8_t)value; record.valid |= SimTrace_F; }
+	else if (!strcmp(n, "B")) { record.b = (uint8_t)value; record.valid |= SimTrace_B; }
+	else if (!strcmp(n, "C")) { record.c = (uint8_t)value; record.valid |= SimTrace_C; }
+	else if (!strcmp(n, "D")) { record.d = (uint8_t)value; record.valid |= SimTrace_D; }
+	else if (!strcmp(n, "E")) { record.e = (uint8_t)value; record.valid |= SimTrace_E; }
+	else if (!strcmp(n, "H")) { record.h = (uint8_t)value; record.valid |= SimTrace_H; }
+	else if (!strcmp(n, "L")) { record.l = (uint8_t)value; record.valid |= SimTrace_L; }
+	else if (!strcmp(n, "AF")) { SetRegister(record, "A", 1, value >> 8); SetRegister(record, "F", 1, value & 0xFF); }
+	else if (!strcmp(n, "BC")) { SetRegister(record, "B", 1, value >> 8); SetRegister(record, "C", 1, value & 0xFF); }
+	else if (!strcmp(n, "DE")) { SetRegister(record, "D", 1, value >> 8); SetRegister(record, "E", 1, value & 0xFF); }
+	else if (!strcmp(n, "HL")) { SetRegister(record, "H", 1, value >> 8); SetRegister(record, "L", 1, value & 0xFF); }
+	else if (!strcmp(n, "IX")) { record.ix = (uint16_t)value; record.valid |= SimTrace_IX; }
+	else if (!strcmp(n, "IY")) { record.iy = (uint16_t)value; record.valid |= SimTrace_IY; }
+	else if (!strcmp(n, "SP")) { record.sp = (uint16_t)value; record.valid |= SimTrace_SP; }
+	else { return false; }
+	return true;
+}
+
+bool SimTrace_ParseLine(const char* line, size_t length, SimTraceRecord& record, const char** text, size_t* text_length)
+{
+	memset(&record, 0, sizeof(record));
+	const char* p = line;
+	const char* end = line + length;
+	while (end > p && (end[-1] == '\r' || end[-1] == '\n')) { end--; }
+
+	while (true) {
+		while (p < end && *p == ' ') { p++; }
+
+		// NAME=HEX register token?
+		const char* name = p;
+		while (p < end && isalpha((unsigned char)*p)) { p++; }
+		if (p > name && p < end && *p == '=') {
+			size_t name_length = p - name;
+			p++;
+			uint32_t value = 0;
+			int v;
+			while (p < end && (v = HexValue(*p)) >= 0) { value = value << 4 | v; p++; }
+			SetRegister(record, name, name_length, value);
+			continue;
+		}
+		p = name;
+		break;
+	}
+
+	// PPPP: mnemonic
+	uint32_t pc = 0;
+	int digits = 0;
+	int v;
+	while (p < end && (v = HexValue(*p)) >= 0) { pc = pc << 4 | v; p++; digits++; }
+	if (digits == 0 || digits > 4 || p >= end || *p != ':') { return false; }
+	p++;
+	if (p < end && *p == ' ') { p++; }
+
+	record.pc = (uint16_t)pc;
+	record.hash = SimTrace_Hash(p, end - p);
+	record.valid |= SimTrace_PC | SimTrace_Text;
+	*text = p;
+	*text_length = end - p;
+	return true;
+}
+
+static const struct {
+	uint16_t field;
+	uint8_t offset;
+	uint8_t size;
+} trace_fields[] = {
+	{ SimTrace_PC, offsetof(SimTraceRecord, pc), 2 },
+	{ SimTrace_Text, offsetof(SimTraceRecord, hash), 4 },
+	{ SimTrace_A, offsetof(SimTraceRecord, a), 1 },
+	{ SimTrace_F, offsetof(SimTraceRecord, f), 1 },
+	{ SimTrace_B, offsetof(SimTraceRecord, b), 1 },
+	{ SimTrace_C, offsetof(SimTraceRecord, c), 1 },
+	{ SimTrace_D, offsetof(SimTraceRecord, d), 1 },
+	{ SimTrace_E, offsetof(SimTraceRecord, e), 1 },
+	{ SimTrace_H, offsetof(SimTraceRecord, h), 1 },
+	{ SimTrace_L, offsetof(SimTraceRecord, l), 1 },
+	{ SimTrace_IX, offsetof(SimTraceRecord, ix), 2 },
+	{ SimTrace_IY, offsetof(SimTraceRecord, iy), 2 },
+	{ SimTrace_SP, offsetof(SimTraceRecord, sp), 2 },
+	{ SimTrace_Opcode, offsetof(SimTraceRecord, opcode), 5 },	// Bytes and length
+	{ SimTrace_Cycle, offsetof(SimTraceRecord, cycle), 8 },
+};
+
+uint16_t SimTrace_Compare(const SimTraceRecord& a, const SimTraceRecord& b, uint16_t fields)
+{
+	// Records are compared as five masked 64-bit words, the byte mask is rebuilt only when the field set changes
+	static uint16_t mask_fields = 0;
+	static uint64_t mask[5] = { 0 };
+	uint16_t active = fields & a.valid & b.valid;
+	if (active != mask_fields) {
+		uint8_t bytes[sizeof(SimTraceRecord)] = { 0 };
+		for (const auto& f : trace_fields) {
+			if (active & f.field) { memset(&bytes[f.offset], 0xFF, f.size); }
+		}
+		memcpy(mask, bytes, sizeof(mask));
+		mask_fields = active;
+	}
+
+	uint64_t wa[5], wb[5];
+	memcpy(wa, &a, sizeof(wa));
+	memcpy(wb, &b, sizeof(wb));
+	uint64_t diff = 0;
+	for (int i = 0; i < 5; i++) { diff |= (wa[i] ^ wb[i]) & mask[i]; }
+	if (!diff) { return 0; }
+
+	// Slow path, work out which fields differ
+	uint16_t differ = 0;
+	for (const auto& f : trace_fields) {
+		if ((active & f.field) && memcmp((const uint8_t*)&a + f.offset, (const uint8_t*)&b + f.offset, f.size)) {
+			differ |= f.field;
+		}
+	}
+	return differ;
+}
+
+int SimTrace_Describe(const SimTraceRecord& record, const char* text, char* out, int size)
+{
+	int n = snprintf(out, size, "%04X: %s", record.pc, text ? text : "");
+	static const char* names[] = { "A", "F", "B", "C", "D", "E", "H", "L" };
+	const uint8_t* regs = &record.a;
+	for (int i = 0; i < 8 && n < size; i++) {
+		if (record.valid & (SimTrace_A << i)) { n += snprintf(out + n, size - n, " %s=%02X", names[i], regs[i]); }
+	}
+	if ((record.valid & SimTrace_IX) && n < size) { n += snprintf(out + n, size - n, " IX=%04X", record.ix); }
+	if ((record.valid & SimTrace_IY) && n < size) { n += snprintf(out + n, size - n, " IY=%04X", record.iy); }
+	if ((record.valid & SimTrace_SP) && n < size) { n += snprintf(out + n, size - n, " SP=%04X", record.sp); }
+	return n < size ? n : size - 1;
+}
+
+SimTraceFile::SimTraceFile()
+{
+	data = NULL;
+	size = 0;
+	file_handle = NULL;
+	mapping_handle = NULL;
+	binary = false;
+	records = NULL;
+	record_count = 0;
+	pool = NULL;
+	pool_size = 0;
+	line_offset = 0;
+	current_index = ~(uint64_t)0;
+	current_text[0] = 0;
+}
+
+SimTraceFile::~SimTraceFile()
+{
+	Close();
+}
+
+static bool ReadLine(FILE* file, std::string& line)
+{
+	char buf[512];
+	line.clear();
+	while (fgets(buf, sizeof(buf), file)) {
+		line.append(buf);
+		if (!line.empty() && line.back() == '\n') { return true; }
+	}
+	return !line.empty();
+}
+
+bool SimTraceFile::Open(const char* filename)
+{
+	Close();
+#ifndef WIN32
+	int fd = open(filename, O_RDONLY);
+	if (fd < 0) {
+		printf("Trace: cannot open %s\n", filename);
+		return false;
+	}
+	struct stat st;
+	if (fstat(fd, &st) == 0 && st.st_size > 0) {
+		size = (size_t)st.st_size;
+		void* ptr = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+		if (ptr == MAP_FAILED) {
+			printf("Trace: cannot map %s\n", filename);
+			close(fd);
+			size = 0;
+			return false;
+		}
+		madvise(ptr, size, MADV_SEQUENTIAL);
+		data = (const char*)ptr;
+	}
+	close(fd);
+#else
+	HANDLE file = CreateFileA(filename, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+	if (file == INVALID_HANDLE_VALUE) {
+		printf("Trace: cannot open %s\n", filename);
+		return false;
+	}
+	LARGE_INTEGER file_size;
+	file_handle = file;
+	if (GetFileSizeEx(file, &file_size) && file_size.QuadPart > 0) {
+		size = (size_t)file_size.QuadPart;
+		mapping_handle = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+		data = mapping_handle ? (const char*)MapViewOfFile(mapping_handle, FILE_MAP_READ, 0, 0, 0) : NULL;
+		if (!data) {
+			printf("Trace: cannot map %s\n", filename);
+			Close();
+			return false;
+		}
+	}
+#endif
+
+	const SimTraceHeader* header = (const SimTraceHeader*)data;
+	if (size >= sizeof(SimTraceHeader) && !memcmp(header->magic, trace_magic, sizeof(trace_magic))) {
+		if (header->version != trace_version || header->record_size != sizeof(SimTraceRecord)) {
+			printf("Trace: %s has an unsupported version\n", filename);
+			Close();
+			return false;
+		}
+		if (header->text_offset < sizeof(SimTraceHeader) || header->text_offset > size || header->text_size > size - header->text_offset ||
+			header->record_count > (header->text_offset - sizeof(SimTraceHeader)) / sizeof(SimTraceRecord)) {
+			printf("Trace: %s is truncated\n", filename);
+			Close();
+			return false;
+		}
+		binary = true;
+		records = (const SimTraceRecord*)(data + sizeof(SimTraceHeader));
+		record_count = header->record_count;
+		pool = data + header->text_offset;
+		pool_size = header->text_size;
+	}
+	return true;
+}
+
+void SimTraceFile::Close()
+{
+#ifndef WIN32
+	if (data) { munmap((void*)data, size); }
+#else
+	if (data) { UnmapViewOfFile(data); }
+	if (mapping_handle) { CloseHandle(mapping_handle); }
+	if (file_handle) { CloseHandle(file_handle); }
+#endif
+	data = NULL;
+	size = 0;
+	file_handle = NULL;
+	mapping_handle = NULL;
+	binary = false;
+	records = NULL;
+	record_count = 0;
+	pool = NULL;
+	pool_size = 0;
+	line_offset = 0;
+	current_index = ~(uint64_t)0;
+	current_text[0] = 0;
+}
+
+bool SimTraceFile::ParseNext()
+{
+	while (line_offset < size) {
+		const char* line = data + line_offset;
+		const char* eol = (const char*)memchr(line, '\n', size - line_offset);
+		size_t length = eol ? (size_t)(eol - line) : size - line_offset;
+		line_offset += length + (eol ? 1 : 0);
+
+		const char* text;
+		size_t text_length;
+		if (!SimTrace_ParseLine(line, length, current, &text, &text_length)) { continue; }
+		if (text_length > sizeof(current_text) - 1) { text_length = sizeof(current_text) - 1; }
+		memcpy(current_text, text, text_length);
+		current_text[text_length] = 0;
+		current.text = 1;
+		current_index++;
+		return true;
+	}
+	return false;
+}
+
+uint64_t SimTraceFile::Count()
+{
+	if (binary) { return record_count; }
+
+	uint64_t count = 0;
+	size_t offset = 0;
+	while (offset < size) {
+		const char* line = data + offset;
+		const char* eol = (const char*)memchr(line, '\n', size - offset);
+		size_t length = eol ? (size_t)(eol - line) : size - offset;
+		offset += length + (eol ? 1 : 0);
+
+		SimTraceRecord record;
+		const char* text;
+		size_t text_length;
+		if (SimTrace_ParseLine(line, length, record, &text, &text_length)) { count++; }
+	}
+	return count;
+}
+
+const SimTraceRecord* SimTraceFile::Get(uint64_t index)
+{
+	if (binary) { return index < record_count ? &records[index] : NULL; }
+
+	if (index == current_index) { return &current; }
+	if (current_index != ~(uint64_t)0 && index < current_index) {
+		// Going backwards means starting again from the top
+		line_offset = 0;
+		current_index = ~(uint64_t)0;
+	}
+	while (current_index == ~(uint64_t)0 || current_index < index) {
+		if (!ParseNext()) { return NULL; }
+	}
+	return &current;
+}
+
+const char* SimTraceFile::Text(const SimTraceRecord* record)
+{
+	if (!record) { return ""; }
+	if (!binary) { return record == &current ? current_text : ""; }
+	if (!record->text || record->text >= pool_size) { return ""; }
+	return &pool[record->text];
+}
+
+bool SimTraceFile::ConvertMame(const char* input, const char* output)
+{
+	FILE* in = fopen(input, "rb");
+	if (!in) {
+		printf("Trace: cannot open %s\n", input);
+		return false;
+	}
+	FILE* out = fopen(output, "wb");
+	if (!out) {
+		printf("Trace: cannot create %s\n", output);
+		fclose(in);
+		return false;
+	}
+
+	SimTraceHeader header;
+	memset(&header, 0, sizeof(header));
+	memcpy(header.magic, trace_magic, sizeof(trace_magic));
+	header.version = trace_version;
+	header.record_size = sizeof(SimTraceRecord);
+	fwrite(&header, sizeof(header), 1, out);
+
+	// Mnemonics repeat constantly, pool each distinct one once
+	std::vector<char> text_pool(1, 0);
+	std::unordered_map<std::string, uint32_t> text_index;
+	std::string line;
+	uint64_t skipped = 0;
+	while (ReadLine(in, line)) {
+		SimTraceRecord record;
+		const char* text;
+		size_t text_length;
+		if (!SimTrace_ParseLine(line.c_str(), line.size(), record, &text, &text_length)) {
+			skipped++;
+			continue;
+		}
+		std::string key(text, text_length);
+		auto found = text_index.find(key);
+		if (found == text_index.end()) {
+			found = text_index.emplace(key, (uint32_t)text_pool.size()).first;
+			text_pool.insert(text_pool.end(), key.begin(), key.end());
+			text_pool.push_back(0);
+		}
+		record.text = found->second;
+		fwrite(&record, sizeof(record), 1, out);
+		header.record_count++;
+	}
+	fclose(in);
+
+	header.text_offset = sizeof(header) + header.record_count * sizeof(SimTraceRecord);
+	header.text_size = text_pool.size();
+	fwrite(text_pool.data(), 1, text_pool.size(), out);
+	fseek(out, 0, SEEK_SET);
+	fwrite(&header, sizeof(header), 1, out);
+	bool ok = !ferror(out);
+	fclose(out);
+
+	printf("Trace: converted %llu instructions (%llu lines skipped, %u distinct mnemonics) to %s\n", (unsigned long long)header.record_count, (unsigned long long)skipped, (unsigned int)text_index.size(), output);
+	return ok;
+}
@@ -0,0 +1,101 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+
+// Fields present in (and compared between) trace records
+enum SimTrace_Field {
+	SimTrace_PC = 1 << 0,
+	SimTrace_Text = 1 << 1,		// Mnemonic hash
+	SimTrace_A = 1 << 2,
+	SimTrace_F = 1 << 3,
+	SimTrace_B = 1 << 4,
+	SimTrace_C = 1 << 5,
+	SimTrace_D = 1 << 6,
+	SimTrace_E = 1 << 7,
+	SimTrace_H = 1 << 8,
+	SimTrace_L = 1 << 9,
+	SimTrace_IX = 1 << 10,
+	SimTrace_IY = 1 << 11,
+	SimTrace_SP = 1 << 12,
+	SimTrace_Opcode = 1 << 13,
+	SimTrace_Cycle = 1 << 14
+};
+
+// One retired instruction, 40 bytes
+// Registers hold the state before the instruction executes, valid says which fields were captured
+struct SimTraceRecord {
+	uint64_t cycle;
+	uint32_t hash;			// Case-insensitive hash of the mnemonic text
+	uint32_t text;			// Offset of the mnemonic in the file's text pool (0 = none)
+	uint16_t pc;
+	uint16_t valid;
+	uint8_t a, f, b, c, d, e, h, l;
+	uint16_t ix, iy, sp;
+	uint8_t opcode[4];
+	uint8_t length;			// Opcode bytes used
+	uint8_t reserved;
+};
+
+// Binary trace file: header, records, then a pool of NUL terminated mnemonics referenced by SimTraceRecord::text
+struct SimTraceHeader {
+	char magic[8];			// "BBCBCTRC"
+	uint32_t version;
+	uint32_t record_size;
+	uint64_t record_count;
+	uint64_t text_offset;	// File offset of the text pool
+	uint64_t text_size;
+};
+
+uint32_t SimTrace_Hash(const char* text, size_t length);
+
+// Parses "PPPP: mnemonic" as written by MAME's trace command and the CPU_DEBUG tracer
+// Leading NAME=HEX register tokens (e.g. from a tracelog prefix) are read into the record
+bool SimTrace_ParseLine(const char* line, size_t length, SimTraceRecord& record, const char** text, size_t* text_length);
+
+// Returns the fields (limited to fields and those valid in both) that differ
+uint16_t SimTrace_Compare(const SimTraceRecord& a, const SimTraceRecord& b, uint16_t fields);
+
+// Human readable record for mismatch reports
+int SimTrace_Describe(const SimTraceRecord& record, const char* text, char* out, int size);
+
+// Reference trace reader
+// The file is memory-mapped, binary traces are indexed in place and MAME text is parsed one line at a time as
+// Get walks forward, so memory use does not grow with the trace length.
+struct SimTraceFile {
+public:
+
+	SimTraceFile();
+	~SimTraceFile();
+
+	// Accepts either a binary trace or MAME trace text
+	bool Open(const char* filename);
+	void Close();
+	uint64_t Count();		// Scans the whole file for text traces
+	// Returns NULL past the end. Text traces are cheapest read in order, the record is valid until the next Get
+	const SimTraceRecord* Get(uint64_t index);
+	const char* Text(const SimTraceRecord* record);
+
+	// Converts MAME trace text into the binary format, returns false on I/O errors
+	static bool ConvertMame(const char* input, const char* output);
+
+private:
+	const char* data;
+	size_t size;
+	void* file_handle;		// WIN32 only
+	void* mapping_handle;	// WIN32 only
+
+	// Binary trace
+	bool binary;
+	const SimTraceRecord* records;
+	uint64_t record_count;
+	const char* pool;
+	uint64_t pool_size;
+
+	// Text trace cursor
+	size_t line_offset;		// Start of the next unparsed line
+	uint64_t current_index;	// Index of current, ~0 before the first line
+	SimTraceRecord current;
+	char current_text[256];
+
+	bool ParseNext();
+};
@@ -2,6 +2,7 @@
 #include "sim_video.h"
 
 #include <string>
+#include <chrono>
 
 #ifndef _MSC_VER
 #include "imgui_impl_sdl.h"
@@ -9,7 +10,6 @@
 #include <stdio.h>
 #include <SDL.h>
 #include <SDL_opengl.h>
-#include <sys/time.h>
 #else
 #define WIN32
 #include "imgui_impl_win32.h"
@@ -18,6 +18,9 @@
 #include <tchar.h>
 #endif
 
+// Simulation time, defined in sim_main.cpp
+extern double sc_time_stamp();
+
 // Renderer variables
 // ------------------
 
@@ -52,16 +55,7 @@ bool last_vsync;
 bool frame_ready = 1;
 
 // Statistics
-#ifdef WIN32
-SYSTEMTIME actualtime;
-LONG time_ms;
-LONG old_time;
-LONG stats_frameTime;
-#else
-double time_ms;
-double old_time;
-double stats_frameTime;
-#endif
+std::chrono::steady_clock::time_point old_time;
 float stats_fps;
 int stats_xMax;
 int stats_yMax;
@@ -177,7 +171,11 @@ LRESULT WINAPI WndProc(HWND hWnd, UINT msg, WPARAM wParam, LPARAM lParam)
 #else
 #endif
 
-SimVideo::SimVideo(int width, int height, int rotate)
+SimVideo::SimVideo(int width, int height, int rotate) : SimVideo(width, height, rotate, 32)
+{
+}
+
+SimVideo::SimVideo(int width, int height, int rotate, int bpp)
 {
 	output_width = width;
 	output_height = height;
@@ -185,13 +183,23 @@ SimVideo::SimVideo(int width, int height, int rotate)
 	output_rotate = rotate;
 	output_vflip = 0;
 
+	// Indexed modes keep a 4bpp or 8bpp framebuffer and only expand to RGBA for display
+	output_bpp = (bpp == 4 || bpp == 8) ? bpp : 32;
+	output_index_ptr = NULL;
+	output_index_size = output_bpp < 32 ? (output_width * output_height * output_bpp) / 8 : 0;
+	for (int i = 0; i < 256; i++) {
+		output_palette[i] = 0xFF000000;
+	}
+
+	frame_export = NULL;
+
 	count_pixel = 0;
 	count_line = 0;
 	count_frame = 0;
 	last_hblank = 0;
 	last_vblank = 0;
 
-	old_time = 0;
+	old_time = std::chrono::steady_clock::now();
 	stats_frameTime = 0;
 	stats_fps = 0.0;
 	stats_xMax = -1000;
@@ -205,10 +213,22 @@ SimVideo::~SimVideo()
 
 }
 
+int SimVideo::InitialiseHeadless() {
+
+	// Framebuffers only, no window or texture
+	output_ptr = (uint32_t*)malloc(output_size);
+	memset(output_ptr, 0, output_size);
+	if (output_index_size > 0) {
+		output_index_ptr = (uint8_t*)malloc(output_index_size);
+		memset(output_index_ptr, 0, output_index_size);
+	}
+	return 0;
+}
+
 int SimVideo::Initialise(const char* windowTitle) {
 
 	// Setup pointers for video texture
-	output_ptr = (uint32_t*)malloc(output_size);
+	InitialiseHeadless();
 
 #ifdef WIN32
 	// Create application window
@@ -340,6 +360,7 @@ void SimVideo::UpdateTexture() {
 	// D3D11_USAGE_DEFAULT MUST be set in the texture description (somewhere above) for this to work.
 	// (D3D11_USAGE_DYNAMIC is for use with map / unmap.) ElectronAsh.
 	if (frame_ready) {
+		if (output_index_ptr) { ExpandPalette(); }
 		g_pd3dDeviceContext->UpdateSubresource(texture, 0, NULL, output_ptr, output_width * 4, 0);
 	}
 	// Rendering
@@ -350,6 +371,7 @@ void SimVideo::UpdateTexture() {
 	g_pSwapChain->Present(output_usevsync, 0); // Present without vsync
 #else
 	if (frame_ready) {
+		if (output_index_ptr) { ExpandPalette(); }
 		glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, output_width, output_height, 0, GL_RGBA, GL_UNSIGNED_BYTE, output_ptr);
 	}
 	// Rendering
@@ -367,6 +389,10 @@ void SimVideo::UpdateTexture() {
 }
 
 void SimVideo::CleanUp() {
+	if (output_index_ptr) {
+		free(output_index_ptr);
+		output_index_ptr = NULL;
+	}
 #ifdef WIN32
 	// Close imgui stuff properly...
 	ImGui_ImplDX11_Shutdown();
@@ -399,7 +425,31 @@ void SimVideo::StartFrame() {
 #endif
 }
 
-void SimVideo::Clock(bool hblank, bool vblank, bool hsync, bool vsync, uint32_t colour) {
+void SimVideo::SetPalette(const uint32_t* palette, int count) {
+	if (count > 256) { count = 256; }
+	for (int i = 0; i < count; i++) {
+		output_palette[i] = palette[i];
+	}
+}
+
+void SimVideo::ExpandPalette() {
+	// Convert indexed framebuffer to RGBA for the display texture
+	int pixels = output_width * output_height;
+	if (output_bpp == 4) {
+		for (int i = 0; i < pixels; i += 2) {
+			uint8_t pair = output_index_ptr[i >> 1];
+			output_ptr[i] = output_palette[pair & 0x0F];
+			output_ptr[i + 1] = output_palette[pair >> 4];
+		}
+	}
+	else {
+		for (int i = 0; i < pixels; i++) {
+			output_ptr[i] = output_palette[output_index_ptr[i]];
+		}
+	}
+}
+
+int SimVideo::Advance(bool hblank, bool vblank, bool hsync, bool vsync) {
 
 	bool de = !(hblank || vblank);
 
@@ -430,19 +480,17 @@ void SimVideo::Clock(bool hblank, bool vblank, bool hsync, bool vsync, uint32_t
 		count_frame++;
 		count_line = 0;
 		frame_ready = 1;
-#ifdef WIN32
-		GetSystemTime(&actualtime);
-		time_ms = (actualtime.wSecond * 1000) + actualtime.wMilliseconds;
-#else
-		struct timeval tv;
-		gettimeofday(&tv, NULL);
-		time_ms = (tv.tv_sec) * 1000 + (tv.tv_usec) / 1000; // convert tv_sec & tv_usec to millisecond
-#endif
-		stats_frameTime = time_ms - old_time;
-		old_time = time_ms;
-		stats_fps = (float)(1000.0 / stats_frameTime);
+		std::chrono::steady_clock::time_point time_now = std::chrono::steady_clock::now();
+		stats_frameTime = std::chrono::duration<float, std::milli>(time_now - old_time).count();
+		old_time = time_now;
+		if (stats_frameTime > 0) { stats_fps = 1000.0f / stats_frameTime; }
+		if (frame_export) {
+			frame_export->Publish(output_index_ptr ? (const void*)output_index_ptr : (const void*)output_ptr, count_frame, (uint64_t)sc_time_stamp());
+		}
 	}
 
+	int vga_addr = -1;
+
 	// Only draw outside of blanks
 	if (de) {
 
@@ -474,11 +522,7 @@ void SimVideo::Clock(bool hblank, bool vblank, bool hsync, bool vsync, uint32_t
 		if (y > output_height - 1) { y = output_height - 1; }
 
 		// Generate texture address
-		uint32_t vga_addr = (y * xs) + x;
-
-		// Write pixel to texture
-		output_ptr[vga_addr] = colour;
-
+		vga_addr = (y * xs) + x;
 	}
 
 	// Track bounds (debug)
@@ -491,4 +535,29 @@ void SimVideo::Clock(bool hblank, bool vblank, bool hsync, bool vsync, uint32_t
 	last_vblank = vblank;
 	last_hsync = hsync;
 	last_vsync = vsync;
+
+	return vga_addr;
+}
+
+void SimVideo::Clock(bool hblank, bool vblank, bool hsync, bool vsync, uint32_t colour) {
+	int vga_addr = Advance(hblank, vblank, hsync, vsync);
+	if (vga_addr < 0) { return; }
+
+	// Write pixel to texture
+	output_ptr[vga_addr] = colour;
+}
+
+void SimVideo::ClockIndexed(bool hblank, bool vblank, bool hsync, bool vsync, uint8_t index) {
+	int vga_addr = Advance(hblank, vblank, hsync, vsync);
+	if (vga_addr < 0) { return; }
+
+	// Write colour index to framebuffer, two pixels per byte in 4bpp mode
+	if (output_bpp == 4) {
+		uint8_t* pair = &output_index_ptr[vga_addr >> 1];
+		if (vga_addr & 1) { *pair = (*pair & 0x0F) | (index << 4); }
+		else { *pair = (*pair & 0xF0) | (index & 0x0F); }
+	}
+	else {
+		output_index_ptr[vga_addr] = index;
+	}
 }
\ No newline at end of file
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <string>
+#include "sim_frame_export.h"
 #ifndef _MSC_VER
 #include "imgui_impl_sdl.h"
 #include "imgui_impl_opengl2.h"
@@ -19,6 +20,15 @@ public:
 	int output_height;
 	int output_rotate;
 	bool output_vflip;
+	int output_bpp;
+
+	// Indexed colour capture (output_bpp of 4 or 8)
+	uint8_t* output_index_ptr;
+	unsigned int output_index_size;
+	uint32_t output_palette[256];
+
+	// Completed frames are published here when set (see sim_frame_export.h)
+	SimFrameExport* frame_export;
 
 	int count_pixel;
 	int count_line;
@@ -34,10 +44,18 @@ public:
 	ImTextureID texture_id;
 
 	SimVideo(int width, int height, int rotate);
+	SimVideo(int width, int height, int rotate, int bpp);
 	~SimVideo();
 	void UpdateTexture();
 	void CleanUp();
 	void StartFrame();
+	void SetPalette(const uint32_t* palette, int count);
 	void Clock(bool hblank, bool vblank, bool hsync, bool vsync, uint32_t colour);
+	void ClockIndexed(bool hblank, bool vblank, bool hsync, bool vsync, uint8_t index);
 	int Initialise(const char* windowTitle);
+	int InitialiseHeadless();
+
+private:
+	int Advance(bool hblank, bool vblank, bool hsync, bool vsync);
+	void ExpandPalette();
 };
@@ -0,0 +1,174 @@
+#include "sim_video_timing.h"
+
+#include "imgui.h"
+
+// VDP18 (TMS9129) timing, see vdp18_hor_vert.sv and vdp18_pkg.sv
+// - 342 pixel clocks per line, hsync for 26 and hblank for 58 of them
+// - 313 lines per PAL frame (262 NTSC), vsync for 3 lines and vblank for 22
+const uint32_t vdp_line_px = 342;
+const uint32_t vdp_hsync_px = 26;
+const uint32_t vdp_hblank_px = 58;
+const uint32_t vdp_lines_pal = 313;
+const uint32_t vdp_lines_ntsc = 262;
+const uint32_t vdp_vsync_lines = 3;
+const uint32_t vdp_vblank_lines = 22;
+
+void SimVideoTiming_Signal::Initialise(const char* name, bool frameLevel, uint32_t expectedPeriod, uint32_t expectedWidth)
+{
+	this->name = name;
+	frame_level = frameLevel;
+	expected_period = expectedPeriod;
+	expected_width = expectedWidth;
+	Reset();
+}
+
+void SimVideoTiming_Signal::Reset()
+{
+	history_pos = 0;
+	history_count = 0;
+	errors = 0;
+	last_level = false;
+	started = false;
+	start_px = 0;
+	start_cycles = 0;
+	active_px = 0;
+	active_cycles = 0;
+}
+
+void SimVideoTiming_Signal::Clock(bool level, uint64_t px, uint64_t cycles)
+{
+	if (level == last_level) { return; }
+	last_level = level;
+
+	if (!level) {
+		// Falling edge ends the active part of the period
+		active_px = (uint32_t)(px - start_px);
+		active_cycles = (uint32_t)(cycles - start_cycles);
+		return;
+	}
+
+	// Rising edge completes the previous period
+	if (started) {
+		uint32_t period = (uint32_t)(px - start_px);
+		period_px[history_pos] = period;
+		period_cycles[history_pos] = (uint32_t)(cycles - start_cycles);
+		width_px[history_pos] = active_px;
+		width_cycles[history_pos] = active_cycles;
+		if ((expected_period && period != expected_period) || (expected_width && active_px != expected_width)) { errors++; }
+		history_pos++;
+		if (history_pos == history_size) { history_pos = 0; }
+		if (history_count < history_size) { history_count++; }
+	}
+	started = true;
+	start_px = px;
+	start_cycles = cycles;
+}
+
+void SimVideoTiming_Signal::Range(const uint32_t* values, uint32_t* min, uint32_t* max)
+{
+	*min = 0xFFFFFFFF;
+	*max = 0;
+	for (int i = 0; i < history_count; i++) {
+		if (values[i] < *min) { *min = values[i]; }
+		if (values[i] > *max) { *max = values[i]; }
+	}
+	if (history_count == 0) { *min = 0; }
+}
+
+SimVideoTiming::SimVideoTiming(bool pal, int cyclesPerPixel)
+{
+	is_pal = pal;
+	cycles_per_pixel = cyclesPerPixel;
+	line_px = vdp_line_px;
+	uint32_t frame_px = (is_pal ? vdp_lines_pal : vdp_lines_ntsc) * vdp_line_px;
+	hsync.Initialise("hsync", false, vdp_line_px, vdp_hsync_px);
+	hblank.Initialise("hblank", false, vdp_line_px, vdp_hblank_px);
+	vsync.Initialise("vsync", true, frame_px, vdp_vsync_lines * vdp_line_px);
+	vblank.Initialise("vblank", true, frame_px, vdp_vblank_lines * vdp_line_px);
+	count_px = 0;
+}
+
+SimVideoTiming::~SimVideoTiming()
+{
+
+}
+
+void SimVideoTiming::Reset()
+{
+	hsync.Reset();
+	hblank.Reset();
+	vsync.Reset();
+	vblank.Reset();
+	count_px = 0;
+}
+
+void SimVideoTiming::Clock(bool hblank, bool vblank, bool hsync, bool vsync, uint64_t cycles)
+{
+	count_px++;
+	this->hsync.Clock(hsync, count_px, cycles);
+	this->hblank.Clock(hblank, count_px, cycles);
+	this->vsync.Clock(vsync, count_px, cycles);
+	this->vblank.Clock(vblank, count_px, cycles);
+}
+
+uint32_t SimVideoTiming::Errors()
+{
+	return hsync.errors + hblank.errors + vsync.errors + vblank.errors;
+}
+
+void SimVideoTiming::Draw(const char* title, bool* p_open, ImVec2 size)
+{
+	ImGui::SetNextWindowSize(size, ImGuiCond_Once);
+	if (!ImGui::Begin(title, p_open))
+	{
+		ImGui::End();
+		return;
+	}
+
+	ImGui::Text("Expected: %s, %d px/line, %d clk_sys cycles/px", is_pal ? "PAL" : "NTSC", line_px, cycles_per_pixel);
+	ImGui::SameLine();
+	if (ImGui::SmallButton("Reset")) { Reset(); }
+
+	SimVideoTiming_Signal* signals[signal_count] = { &hsync, &hblank, &vsync, &vblank };
+	if (ImGui::BeginTable("timing", 7, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingFixedFit)) {
+		ImGui::TableSetupColumn("Signal");
+		ImGui::TableSetupColumn("Period min/max");
+		ImGui::TableSetupColumn("Jitter");
+		ImGui::TableSetupColumn("Width min/max");
+		ImGui::TableSetupColumn("Jitter");
+		ImGui::TableSetupColumn("Period cycles");
+		ImGui::TableSetupColumn("Errors");
+		ImGui::TableHeadersRow();
+		for (int s = 0; s < signal_count; s++) {
+			SimVideoTiming_Signal* signal = signals[s];
+			uint32_t pmin, pmax, wmin, wmax, cmin, cmax;
+			signal->Range(signal->period_px, &pmin, &pmax);
+			signal->Range(signal->width_px, &wmin, &wmax);
+			signal->Range(signal->period_cycles, &cmin, &cmax);
+			// Frame level signals are shown in lines
+			float scale = signal->frame_level ? 1.0f / line_px : 1.0f;
+			const char* unit = signal->frame_level ? "ln" : "px";
+
+			ImGui::TableNextRow();
+			ImGui::TableNextColumn(); ImGui::TextUnformatted(signal->name);
+			ImGui::TableNextColumn(); ImGui::Text("%.6g/%.6g %s", pmin * scale, pmax * scale, unit);
+			ImGui::TableNextColumn(); ImGui::Text("%u px", pmax - pmin);
+			ImGui::TableNextColumn(); ImGui::Text("%.6g/%.6g %s", wmin * scale, wmax * scale, unit);
+			ImGui::TableNextColumn(); ImGui::Text("%u px", wmax - wmin);
+			ImGui::TableNextColumn(); ImGui::Text("%u/%u", cmin, cmax);
+			ImGui::TableNextColumn();
+			if (signal->history_count == 0) {
+				ImGui::TextDisabled("-");
+			}
+			else if (signal->errors > 0) {
+				ImGui::TextColored(ImVec4(1.0f, 0.4f, 0.4f, 1.0f), "%u (expect %.6g/%.6g)", signal->errors, signal->expected_period * scale, signal->expected_width * scale);
+			}
+			else {
+				ImGui::TextColored(ImVec4(0.4f, 1.0f, 0.4f, 1.0f), "OK");
+			}
+		}
+		ImGui::EndTable();
+	}
+
+	ImGui::End();
+}
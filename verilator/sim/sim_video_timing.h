@@ -0,0 +1,59 @@
+#pragma once
+
+#include <stdint.h>
+#include "imgui.h"
+
+struct SimVideoTiming_Signal {
+public:
+
+	static const int history_size = 256;
+
+	const char* name;
+	bool frame_level;				// Display in lines rather than pixel clocks
+	uint32_t expected_period;		// Pixel clocks, 0 = not checked
+	uint32_t expected_width;		// Pixel clocks, 0 = not checked
+
+	// Ring buffer of completed measurements
+	uint32_t period_px[history_size];
+	uint32_t width_px[history_size];
+	uint32_t period_cycles[history_size];
+	uint32_t width_cycles[history_size];
+	int history_pos;
+	int history_count;
+	uint32_t errors;
+
+	void Initialise(const char* name, bool frameLevel, uint32_t expectedPeriod, uint32_t expectedWidth);
+	void Reset();
+	void Clock(bool level, uint64_t px, uint64_t cycles);
+	void Range(const uint32_t* values, uint32_t* min, uint32_t* max);
+
+private:
+	bool last_level;
+	bool started;
+	uint64_t start_px;
+	uint64_t start_cycles;
+	uint32_t active_px;
+	uint32_t active_cycles;
+};
+
+struct SimVideoTiming {
+public:
+
+	static const int signal_count = 4;
+	SimVideoTiming_Signal hsync;
+	SimVideoTiming_Signal hblank;
+	SimVideoTiming_Signal vsync;
+	SimVideoTiming_Signal vblank;
+
+	bool is_pal;
+	int cycles_per_pixel;
+	uint32_t line_px;
+	uint64_t count_px;
+
+	SimVideoTiming(bool pal, int cyclesPerPixel);
+	~SimVideoTiming();
+	void Reset();
+	void Clock(bool hblank, bool vblank, bool hsync, bool vsync, uint64_t cycles);
+	uint32_t Errors();
+	void Draw(const char* title, bool* p_open, ImVec2 size);
+};
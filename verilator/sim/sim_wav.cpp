@@ -0,0 +1,194 @@
+#include "sim_wav.h"
+
+#include <string.h>
+
+static void put16(uint8_t*& p, uint16_t v)
+{
+	*p++ = v & 0xFF;
+	*p++ = v >> 8;
+}
+
+static void put32(uint8_t*& p, uint32_t v)
+{
+	put16(p, v & 0xFFFF);
+	put16(p, v >> 16);
+}
+
+static void putTag(uint8_t*& p, const char* tag)
+{
+	memcpy(p, tag, 4);
+	p += 4;
+}
+
+SimWavWriter::SimWavWriter()
+{
+	is_open = false;
+	float_format = true;
+	sample_rate = 0;
+	frames_written = 0;
+	writer_stalls = 0;
+	file = NULL;
+	sample_bytes = 4;
+	block_ptr = NULL;
+	block_pos = 0;
+	block_size = 0;
+	stopping = false;
+}
+
+SimWavWriter::~SimWavWriter()
+{
+	Close();
+}
+
+bool SimWavWriter::Open(const char* filename, int sampleRate, bool floatFormat)
+{
+	Close();
+	file = fopen(filename, "wb");
+	if (!file) {
+		printf("WAV: unable to open %s\n", filename);
+		return false;
+	}
+
+	sample_rate = sampleRate;
+	float_format = floatFormat;
+	sample_bytes = float_format ? 4 : 2;
+	block_size = block_frames * channels * sample_bytes;
+	frames_written = 0;
+	writer_stalls = 0;
+
+	// Placeholder header, sizes are patched on close
+	WriteHeader(0);
+
+	full_head = 0;
+	full_count = 0;
+	free_head = 0;
+	free_count = 0;
+	for (int b = 0; b < block_count; b++) {
+		blocks[b].resize(block_size);
+		block_used[b] = 0;
+		if (b > 0) { free_queue[free_count++] = b; }
+	}
+	block_current = 0;
+	block_ptr = blocks[0].data();
+	block_pos = 0;
+
+	stopping = false;
+	writer = std::thread(&SimWavWriter::WriterThread, this);
+	is_open = true;
+	return true;
+}
+
+void SimWavWriter::Write(float left, float right)
+{
+	if (!is_open) { return; }
+
+	if (float_format) {
+		memcpy(block_ptr + block_pos, &left, sizeof(float));
+		memcpy(block_ptr + block_pos + 4, &right, sizeof(float));
+	}
+	else {
+		int l = (int)(left * 32767.0f);
+		int r = (int)(right * 32767.0f);
+		if (l > 32767) { l = 32767; } else if (l < -32768) { l = -32768; }
+		if (r > 32767) { r = 32767; } else if (r < -32768) { r = -32768; }
+		int16_t samples[2] = { (int16_t)l, (int16_t)r };
+		memcpy(block_ptr + block_pos, samples, sizeof(samples));
+	}
+	block_pos += channels * sample_bytes;
+	frames_written++;
+
+	if (block_pos == block_size) { SubmitBlock(); }
+}
+
+void SimWavWriter::SubmitBlock()
+{
+	std::unique_lock<std::mutex> guard(lock);
+	block_used[block_current] = block_pos;
+	full_queue[(full_head + full_count) % block_count] = block_current;
+	full_count++;
+	full_ready.notify_one();
+
+	// Only waits if the disk has fallen a whole ring of blocks behind
+	if (free_count == 0) {
+		writer_stalls++;
+		free_ready.wait(guard, [this] { return free_count > 0; });
+	}
+	block_current = free_queue[free_head];
+	free_head = (free_head + 1) % block_count;
+	free_count--;
+	block_ptr = blocks[block_current].data();
+	block_pos = 0;
+}
+
+void SimWavWriter::WriterThread()
+{
+	std::unique_lock<std::mutex> guard(lock);
+	while (true) {
+		full_ready.wait(guard, [this] { return full_count > 0 || stopping; });
+		if (full_count == 0) { return; }
+
+		int b = full_queue[full_head];
+		full_head = (full_head + 1) % block_count;
+		full_count--;
+
+		guard.unlock();
+		fwrite(blocks[b].data(), 1, block_used[b], file);
+		guard.lock();
+
+		free_queue[(free_head + free_count) % block_count] = b;
+		free_count++;
+		free_ready.notify_one();
+	}
+}
+
+void SimWavWriter::WriteHeader(uint32_t dataBytes)
+{
+	// PCM uses the canonical 44 byte header, float adds cbSize and the fact chunk required for non-PCM formats
+	uint8_t header[58];
+	uint8_t* p = header;
+	uint32_t fmtSize = float_format ? 18 : 16;
+	uint32_t headerSize = float_format ? 58 : 44;
+	uint16_t blockAlign = channels * sample_bytes;
+
+	putTag(p, "RIFF");
+	put32(p, headerSize - 8 + dataBytes);
+	putTag(p, "WAVE");
+	putTag(p, "fmt ");
+	put32(p, fmtSize);
+	put16(p, float_format ? 3 : 1);
+	put16(p, channels);
+	put32(p, sample_rate);
+	put32(p, sample_rate * blockAlign);
+	put16(p, blockAlign);
+	put16(p, sample_bytes * 8);
+	if (float_format) {
+		put16(p, 0);
+		putTag(p, "fact");
+		put32(p, 4);
+		put32(p, dataBytes / blockAlign);
+	}
+	putTag(p, "data");
+	put32(p, dataBytes);
+
+	fseek(file, 0, SEEK_SET);
+	fwrite(header, 1, headerSize, file);
+}
+
+void SimWavWriter::Close()
+{
+	if (!is_open) { return; }
+	is_open = false;
+
+	// Flush the partial block and wait for the writer to drain the queue
+	if (block_pos > 0) { SubmitBlock(); }
+	{
+		std::lock_guard<std::mutex> guard(lock);
+		stopping = true;
+	}
+	full_ready.notify_one();
+	writer.join();
+
+	WriteHeader((uint32_t)(frames_written * channels * sample_bytes));
+	fclose(file);
+	file = NULL;
+}
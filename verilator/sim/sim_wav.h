@@ -0,0 +1,56 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdio.h>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <vector>
+
+// Stereo WAV file writer
+// Samples are collected into fixed-size blocks on the caller's thread and written to disk by a background thread.
+// The RIFF header is written with zero sizes on open and patched on close.
+struct SimWavWriter {
+public:
+
+	static const int block_count = 8;
+	static const int block_frames = 8192;
+	static const int channels = 2;
+
+	bool is_open;
+	bool float_format;			// 32-bit IEEE float, otherwise 16-bit PCM
+	int sample_rate;
+	uint64_t frames_written;
+	uint32_t writer_stalls;		// Times the caller had to wait for a free block
+
+	SimWavWriter();
+	~SimWavWriter();
+	bool Open(const char* filename, int sampleRate, bool floatFormat);
+	void Write(float left, float right);
+	void Close();
+
+private:
+	FILE* file;
+	int sample_bytes;
+	std::vector<uint8_t> blocks[block_count];
+	uint32_t block_used[block_count];
+
+	// Blocks move caller -> writer through a full queue and back through a free queue
+	int block_current;
+	uint8_t* block_ptr;
+	uint32_t block_pos;
+	uint32_t block_size;
+	int full_queue[block_count];
+	int full_head, full_count;
+	int free_queue[block_count];
+	int free_head, free_count;
+	bool stopping;
+	std::mutex lock;
+	std::condition_variable full_ready;
+	std::condition_variable free_ready;
+	std::thread writer;
+
+	void SubmitBlock();
+	void WriterThread();
+	void WriteHeader(uint32_t dataBytes);
+};
@@ -0,0 +1,121 @@
+#include "sim_z80_disasm.h"
+#include "sim_z80_opcodes.h"
+
+static const char hex_upper[] = "0123456789ABCDEF";
+static const char hex_lower[] = "0123456789abcdef";
+static const char missing[] = " - MISSING OPCODE";
+
+const SimZ80_Opcode* SimZ80Disasm::Lookup(uint8_t superext, uint8_t ext, uint8_t ir)
+{
+	// A lone prefix may have been captured in either slot
+	uint8_t prefix = ext ? ext : superext;
+	if (superext && ext) {
+		if (ext != 0xCB) { return NULL; }
+		if (superext == 0xDD) { return &simz80_ddcb[ir]; }
+		if (superext == 0xFD) { return &simz80_fdcb[ir]; }
+		return NULL;
+	}
+	switch (prefix) {
+	case 0x00: return &simz80_base[ir];
+	case 0xCB: return &simz80_cb[ir];
+	case 0xED: return &simz80_ed[ir];
+	case 0xDD: return &simz80_dd[ir];
+	case 0xFD: return &simz80_fd[ir];
+	}
+	return NULL;
+}
+
+bool SimZ80Disasm::IsPrefix(uint8_t ir)
+{
+	return simz80_base[ir].prefix;
+}
+
+bool SimZ80Disasm_Fetch::Extend(uint8_t ir)
+{
+	if (!in_prefix) { return false; }
+	// Only DD/FD can be followed by a second prefix (CB)
+	in_prefix = (opcode == 0xDD || opcode == 0xFD) && ir == 0xCB;
+	opcode = opcode << 8 | ir;
+	return true;
+}
+
+void SimZ80Disasm_Fetch::Start(uint8_t ir)
+{
+	opcode = ir;
+	in_prefix = SimZ80Disasm::IsPrefix(ir);
+}
+
+int SimZ80Disasm::Format(const SimZ80_Opcode* op, uint16_t pc, const uint8_t* data, int data_count, char* out, int size)
+{
+	if (size <= 0) { return 0; }
+	char* p = out;
+	char* end = out + size - 1;
+	if (!op || !op->text[0]) {
+		for (const char* s = missing + 3; *s && p < end; s++) { *p++ = *s; }
+		*p = 0;
+		return (int)(p - out);
+	}
+
+	int next_byte = 0;
+	for (int part = 0; part < 3; part++) {
+		for (const char* s = op->text[part]; *s && p < end; s++) { *p++ = *s; }
+		if (part == 2) { break; }
+
+		if (!data) {
+			// Operand bytes unknown, name the operand instead
+			static const char* names[] = { "", "n", "nn", "e", "e" };
+			for (const char* s = names[op->operand[part]]; *s && p < end; s++) { *p++ = *s; }
+			continue;
+		}
+
+		uint16_t value = 0;
+		int digits = 0;
+		switch (op->operand[part]) {
+		case SimZ80_OperandByte:
+			value = data[next_byte++];
+			digits = 2;
+			break;
+		case SimZ80_OperandWord:
+			value = (uint16_t)(data[1] << 8 | data[0]);
+			digits = 4;
+			break;
+		case SimZ80_OperandJump: {
+			// Displacement position matches the original string based tracer
+			int8_t d = (int8_t)(data_count == 1 ? data[0] : data[1]);
+			value = (uint16_t)(pc + d + 2);
+			digits = 4;
+			break;
+		}
+		case SimZ80_OperandNext:
+			value = (uint16_t)(pc + 2);
+			digits = 4;
+			break;
+		}
+		if (digits && p < end) { *p++ = '$'; }
+		for (int d = digits - 1; d >= 0 && p < end; d--) { *p++ = hex_upper[(value >> (d * 4)) & 0xF]; }
+	}
+	*p = 0;
+	return (int)(p - out);
+}
+
+int SimZ80Disasm::Format(uint8_t superext, uint8_t ext, uint8_t ir, uint16_t pc, const uint8_t* data, int data_count, char* out, int size)
+{
+	const SimZ80_Opcode* op = Lookup(superext, ext, ir);
+	if (op && op->text[0]) { return Format(op, pc, data, data_count, out, size); }
+	if (size <= 0) { return 0; }
+
+	// Unknown opcode, report the lookup key as the old map based tracer did
+	char* p = out;
+	char* end = out + size - 1;
+	uint8_t key[3] = { superext, ext, ir };
+	if (p < end) { *p++ = '0'; }
+	if (p < end) { *p++ = 'x'; }
+	for (int i = 0; i < 3; i++) {
+		if (i < 2 && !key[i]) { continue; }
+		if (p < end) { *p++ = hex_lower[key[i] >> 4]; }
+		if (p < end) { *p++ = hex_lower[key[i] & 0xF]; }
+	}
+	for (const char* s = missing; *s && p < end; s++) { *p++ = *s; }
+	*p = 0;
+	return (int)(p - out);
+}
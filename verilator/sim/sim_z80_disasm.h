@@ -0,0 +1,51 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+
+enum SimZ80_Operand {
+	SimZ80_OperandNone,
+	SimZ80_OperandByte,		// Next unused operand byte
+	SimZ80_OperandWord,		// Little endian 16-bit immediate
+	SimZ80_OperandJump,		// pc + signed displacement + 2
+	SimZ80_OperandNext		// pc + 2
+};
+
+// Pre-parsed mnemonic, text[0] operand[0] text[1] operand[1] text[2]
+// text[0] is NULL for opcodes missing from z80_opcodes.csv
+struct SimZ80_Opcode {
+	const char* text[3];
+	uint8_t operand[2];
+	bool prefix;			// "****" entry, the next IR extends this one
+	uint8_t cycles;			// Documented T-states, 0 when undocumented
+	uint8_t cycles_alt;		// T-states when the condition is met or a block instruction repeats, 0 if fixed
+};
+
+// Folds prefix bytes into the instruction they start as opcodes are fetched
+// opcode holds superext << 16 | ext << 8 | ir
+struct SimZ80Disasm_Fetch {
+public:
+	uint32_t opcode = 0;
+	bool in_prefix = false;
+
+	// True when ir continues the current prefixed instruction, otherwise the caller should finish the
+	// current instruction and call Start
+	bool Extend(uint8_t ir);
+	void Start(uint8_t ir);
+};
+
+// Z80 disassembler driven by the tables generated from z80_opcodes.csv (see z80_opcodes.py)
+// Lookups and formatting are table indexing and character copies, nothing is allocated.
+struct SimZ80Disasm {
+public:
+
+	// Prefix bytes follow the tracer's IR capture: superext is the first of a DD/FD CB pair, ext the prefix before ir
+	static const SimZ80_Opcode* Lookup(uint8_t superext, uint8_t ext, uint8_t ir);
+	static bool IsPrefix(uint8_t ir);
+	static const SimZ80_Opcode* Lookup(uint32_t opcode) { return Lookup((opcode >> 16) & 0xFF, (opcode >> 8) & 0xFF, opcode & 0xFF); }
+
+	// Writes the mnemonic with operands filled from data, returns the length written (excluding the terminator)
+	// data must hold at least two bytes (zero filled when fewer were fetched), data_count is the number fetched
+	// With data NULL operands are written as n, nn or e
+	static int Format(const SimZ80_Opcode* op, uint16_t pc, const uint8_t* data, int data_count, char* out, int size);
+	static int Format(uint8_t superext, uint8_t ext, uint8_t ir, uint16_t pc, const uint8_t* data, int data_count, char* out, int size);
+};
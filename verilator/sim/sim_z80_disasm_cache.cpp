@@ -0,0 +1,295 @@
+#include "sim_z80_disasm_cache.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+
+// Reset, IM 1 and NMI entry points
+static const uint16_t vectors[] = { 0x0000, 0x0038, 0x0066 };
+
+static const uint16_t ram_start = 0xE000;
+
+// Length of an unprefixed instruction
+static int BaseLength(uint8_t op)
+{
+	if ((op & 0xC7) == 0x06 || (op & 0xC7) == 0xC6) { return 2; }		// ld r,n / alu n
+	if (op == 0x10 || op == 0x18 || (op & 0xE7) == 0x20) { return 2; }	// djnz / jr / jr cc
+	if (op == 0xD3 || op == 0xDB) { return 2; }							// out (n),a / in a,(n)
+	if ((op & 0xCF) == 0x01) { return 3; }								// ld rr,nn
+	if (op == 0x22 || op == 0x2A || op == 0x32 || op == 0x3A) { return 3; }
+	if ((op & 0xC7) == 0xC2 || op == 0xC3 || (op & 0xC7) == 0xC4 || op == 0xCD) { return 3; }
+	return 1;
+}
+
+// Unprefixed opcodes using (hl), which take a displacement byte after DD/FD
+static bool IndexedMemory(uint8_t op)
+{
+	if (op == 0x34 || op == 0x35 || op == 0x36) { return true; }
+	return op >= 0x40 && op < 0xC0 && op != 0x76 && ((op & 7) == 6 || (op & 0xF8) == 0x70);
+}
+
+// Control flow of a decoded instruction, sets target when it can transfer to a known address
+// Returns false when execution never falls through to the next instruction
+static bool Flow(const SimZ80DisasmCache_Entry& entry, uint16_t pc, bool* has_target, uint16_t* target)
+{
+	const uint8_t* b = entry.bytes;
+	uint16_t next = pc + entry.length;
+	uint16_t word = b[1] | b[2] << 8;
+	uint16_t relative = next + (int8_t)b[1];
+	*has_target = false;
+	switch (b[0]) {
+	case 0xC3: *has_target = true; *target = word; return false;		// jp nn
+	case 0x18: *has_target = true; *target = relative; return false;	// jr e
+	case 0x10: case 0x20: case 0x28: case 0x30: case 0x38:				// djnz / jr cc
+		*has_target = true; *target = relative; return true;
+	case 0xCD: *has_target = true; *target = word; return true;			// call nn
+	case 0xC9: case 0xE9: return false;									// ret / jp (hl)
+	case 0xED: return (b[1] & 0xC7) != 0x45;							// retn / reti
+	case 0xDD: case 0xFD: return b[1] != 0xE9;							// jp (ix) / jp (iy)
+	}
+	if ((b[0] & 0xC7) == 0xC2 || (b[0] & 0xC7) == 0xC4) { *has_target = true; *target = word; }	// jp cc / call cc
+	else if ((b[0] & 0xC7) == 0xC7) { *has_target = true; *target = b[0] & 0x38; }					// rst
+	return true;
+}
+
+SimZ80DisasmCache::SimZ80DisasmCache()
+{
+	ram = NULL;
+	follow_pc = true;
+	goto_text[0] = 0;
+	scroll_row = -1;
+	Clear();
+}
+
+SimZ80DisasmCache::~SimZ80DisasmCache()
+{
+}
+
+void SimZ80DisasmCache::Clear()
+{
+	memset(entries, 0, sizeof(entries));
+	memset(rom, 0, sizeof(rom));
+	memset(rom_loaded, 0, sizeof(rom_loaded));
+	code_count = 0;
+	rows.clear();
+	rows_code_count = -1;
+}
+
+bool SimZ80DisasmCache::LoadHex(const char* filename, uint16_t base, int size)
+{
+	FILE* file = fopen(filename, "r");
+	if (!file) {
+		printf("Disassembly: cannot open %s\n", filename);
+		return false;
+	}
+	int count = 0;
+	unsigned int value;
+	while (count < size && base + count < (int)sizeof(rom) && fscanf(file, "%x", &value) == 1) {
+		rom[base + count] = (uint8_t)value;
+		rom_loaded[base + count] = true;
+		count++;
+	}
+	fclose(file);
+	return true;
+}
+
+bool SimZ80DisasmCache::Mapped(uint16_t address)
+{
+	if (address >= ram_start) { return ram != NULL; }
+	return address < sizeof(rom) && rom_loaded[address];
+}
+
+uint8_t SimZ80DisasmCache::Read(uint16_t address)
+{
+	if (address >= ram_start) { return ram ? ram[address - ram_start] : 0; }
+	if (address < sizeof(rom)) { return rom[address]; }
+	return 0;	// Unmapped reads as 0 (system.v mem_data_out)
+}
+
+void SimZ80DisasmCache::Decode(uint16_t pc, SimZ80DisasmCache_Entry& entry)
+{
+	uint8_t* b = entry.bytes;
+	for (int i = 0; i < 4; i++) { b[i] = Read(pc + i); }
+	if (b[0] == 0xCB) {
+		entry.opcode = 0xCB00 | b[1];
+		entry.length = 2;
+	}
+	else if (b[0] == 0xED) {
+		entry.opcode = 0xED00 | b[1];
+		entry.length = (b[1] & 0xC7) == 0x43 ? 4 : 2;	// ld (nn),rr / ld rr,(nn)
+	}
+	else if (b[0] == 0xDD || b[0] == 0xFD) {
+		if (b[1] == 0xCB) {
+			// DD CB d op, the displacement is the operand
+			entry.opcode = b[0] << 16 | 0xCB00 | b[3];
+			entry.length = 4;
+		}
+		else if (b[1] == 0xDD || b[1] == 0xED || b[1] == 0xFD) {
+			// Prefix on its own, the next prefix starts a new instruction
+			entry.opcode = b[0];
+			entry.length = 1;
+		}
+		else {
+			entry.opcode = b[0] << 8 | b[1];
+			entry.length = 1 + BaseLength(b[1]) + (IndexedMemory(b[1]) ? 1 : 0);
+		}
+	}
+	else {
+		entry.opcode = b[0];
+		entry.length = BaseLength(b[0]);
+	}
+	entry.data_offset = entry.opcode > 0xFF ? 2 : 1;
+	entry.flags |= SimZ80DisasmCache_Decoded;
+}
+
+void SimZ80DisasmCache::Rebuild()
+{
+	for (auto& entry : entries) { entry.flags = 0; }
+	code_count = 0;
+	for (uint16_t vector : vectors) {
+		if (!Mapped(vector) || vector >= ram_start) { continue; }
+		entries[vector].flags |= SimZ80DisasmCache_Vector;
+		Descend(vector);
+	}
+}
+
+void SimZ80DisasmCache::Descend(uint16_t start)
+{
+	// Worklist rather than recursion, ROMs can chain thousands of branches
+	std::vector<uint16_t> pending;
+	pending.push_back(start);
+	while (!pending.empty()) {
+		uint16_t pc = pending.back();
+		pending.pop_back();
+		// RAM changes under the descent, it is only decoded on lookup
+		while (pc < ram_start && Mapped(pc)) {
+			SimZ80DisasmCache_Entry& entry = entries[pc];
+			if (entry.flags & SimZ80DisasmCache_Code) { break; }
+			Decode(pc, entry);
+			entry.flags |= SimZ80DisasmCache_Code;
+			code_count++;
+
+			bool has_target;
+			uint16_t target;
+			bool next = Flow(entry, pc, &has_target, &target);
+			if (has_target) {
+				entries[target].flags |= SimZ80DisasmCache_Target;
+				pending.push_back(target);
+			}
+			if (!next) { break; }
+			pc += entry.length;
+		}
+	}
+}
+
+const SimZ80DisasmCache_Entry* SimZ80DisasmCache::Lookup(uint16_t pc)
+{
+	if (!Mapped(pc)) { return NULL; }
+	SimZ80DisasmCache_Entry& entry = entries[pc];
+	if (pc >= ram_start) {
+		bool stale = !(entry.flags & SimZ80DisasmCache_Decoded);
+		for (int i = 0; i < entry.length && !stale; i++) { stale = entry.bytes[i] != Read(pc + i); }
+		if (stale) { Decode(pc, entry); }
+	}
+	else if (!(entry.flags & SimZ80DisasmCache_Code)) {
+		// Reached at run time, e.g. through jp (hl)
+		Descend(pc);
+	}
+	return &entry;
+}
+
+int SimZ80DisasmCache::Format(uint16_t pc, char* out, int size)
+{
+	const SimZ80DisasmCache_Entry* entry = Lookup(pc);
+	if (!entry) {
+		if (size > 0) { out[0] = 0; }
+		return 0;
+	}
+	const SimZ80_Opcode* op = SimZ80Disasm::Lookup(entry->opcode);
+	return SimZ80Disasm::Format(op, pc, entry->bytes + entry->data_offset, entry->length - entry->data_offset, out, size);
+}
+
+void SimZ80DisasmCache::Draw(const char* title, bool* p_open, ImVec2 size, uint16_t pc)
+{
+	ImGui::SetNextWindowSize(size, ImGuiCond_Once);
+	if (!ImGui::Begin(title, p_open))
+	{
+		ImGui::End();
+		return;
+	}
+
+	if (rows_code_count != code_count) {
+		rows.clear();
+		for (int address = 0; address < 0x10000; address++) {
+			if (entries[address].flags & SimZ80DisasmCache_Code) { rows.push_back((uint16_t)address); }
+		}
+		rows_code_count = code_count;
+	}
+
+	ImGui::Checkbox("Follow PC", &follow_pc);
+	ImGui::SameLine();
+	ImGui::SetNextItemWidth(60);
+	bool go = ImGui::InputText("##goto", goto_text, sizeof(goto_text), ImGuiInputTextFlags_CharsHexadecimal | ImGuiInputTextFlags_EnterReturnsTrue);
+	ImGui::SameLine();
+	go |= ImGui::SmallButton("Go to");
+	ImGui::SameLine();
+	ImGui::Text("%d instructions decoded", code_count);
+
+	uint16_t scroll_to = pc;
+	bool scroll = follow_pc;
+	if (go && goto_text[0]) {
+		scroll_to = (uint16_t)strtoul(goto_text, NULL, 16);
+		scroll = true;
+		follow_pc = false;
+	}
+	int scroll_index = -1;
+	if (scroll) {
+		// Nearest decoded instruction at or before the address
+		auto it = std::upper_bound(rows.begin(), rows.end(), scroll_to);
+		if (it != rows.begin()) { scroll_index = (int)(it - rows.begin()) - 1; }
+		if (scroll_index == scroll_row && !go) { scroll_index = -1; }	// Only scroll when the row moves
+		else { scroll_row = scroll_index; }
+	}
+
+	ImGuiTableFlags flags = ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingFixedFit | ImGuiTableFlags_ScrollY;
+	if (ImGui::BeginTable("listing", 4, flags)) {
+		ImGui::TableSetupScrollFreeze(0, 1);
+		ImGui::TableSetupColumn("");
+		ImGui::TableSetupColumn("Address");
+		ImGui::TableSetupColumn("Bytes");
+		ImGui::TableSetupColumn("Disassembly", ImGuiTableColumnFlags_WidthStretch);
+		ImGui::TableHeadersRow();
+
+		if (scroll_index >= 0) {
+			float row_height = ImGui::GetTextLineHeightWithSpacing();
+			ImGui::SetScrollY(scroll_index * row_height - ImGui::GetWindowHeight() * 0.5f);
+		}
+
+		ImGuiListClipper clipper;
+		clipper.Begin((int)rows.size());
+		char text[64];
+		while (clipper.Step()) {
+			for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; i++) {
+				uint16_t address = rows[i];
+				const SimZ80DisasmCache_Entry& entry = entries[address];
+				Format(address, text, sizeof(text));
+				ImGui::TableNextRow();
+				if (address == pc) { ImGui::TableSetBgColor(ImGuiTableBgTarget_RowBg0, IM_COL32(80, 80, 20, 255)); }
+				ImGui::TableNextColumn();
+				ImGui::TextUnformatted(address == pc ? ">" : (entry.flags & SimZ80DisasmCache_Vector) ? "V" : (entry.flags & SimZ80DisasmCache_Target) ? "*" : "");
+				ImGui::TableNextColumn(); ImGui::Text("%04X", address);
+				ImGui::TableNextColumn();
+				char bytes[12];
+				int length = 0;
+				for (int b = 0; b < entry.length; b++) { length += snprintf(bytes + length, sizeof(bytes) - length, b ? " %02X" : "%02X", entry.bytes[b]); }
+				bytes[length] = 0;
+				ImGui::TextUnformatted(bytes);
+				ImGui::TableNextColumn(); ImGui::TextUnformatted(text);
+			}
+		}
+		ImGui::EndTable();
+	}
+
+	ImGui::End();
+}
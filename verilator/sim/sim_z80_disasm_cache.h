@@ -0,0 +1,60 @@
+#pragma once
+#include <stdint.h>
+#include <vector>
+#include "imgui.h"
+#include "sim_z80_disasm.h"
+
+enum SimZ80DisasmCache_Flags {
+	SimZ80DisasmCache_Decoded = 1,		// Entry holds the instruction starting at this address
+	SimZ80DisasmCache_Code = 2,			// Reached by recursive descent
+	SimZ80DisasmCache_Target = 4,		// Jump, call or rst target
+	SimZ80DisasmCache_Vector = 8		// Reset or interrupt vector
+};
+
+// Instruction decoded at one address, 12 bytes so the whole 64K map stays compact
+struct SimZ80DisasmCache_Entry {
+public:
+	uint32_t opcode;		// superext << 16 | ext << 8 | ir, as the tracer and profiler see it
+	uint8_t bytes[4];		// Raw instruction bytes, RAM entries are checked against these
+	uint8_t length;
+	uint8_t data_offset;	// First operand byte in bytes
+	uint8_t flags;
+	uint8_t reserved;
+};
+
+// Address indexed Z80 disassembly of the BIOS and cartridge ROM images
+// ROM code is decoded once by recursive descent from the reset and interrupt vectors, following jumps, calls and rsts.
+// Addresses the descent did not reach (computed jumps) are decoded, and descended from, the first time they are looked up.
+// RAM code is decoded on lookup and decoded again whenever the bytes it was decoded from have been written.
+struct SimZ80DisasmCache {
+public:
+
+	const uint8_t* ram;		// Live CPU RAM (8Kb at E000), NULL until attached
+
+	SimZ80DisasmCache();
+	~SimZ80DisasmCache();
+	void Clear();
+	bool LoadHex(const char* filename, uint16_t base, int size);	// $readmemh image, as loaded by dpram/sprom
+	void Rebuild();
+	void Descend(uint16_t pc);
+	const SimZ80DisasmCache_Entry* Lookup(uint16_t pc);	// NULL when nothing is mapped at pc
+	int Format(uint16_t pc, char* out, int size);
+	int CodeCount() { return code_count; }
+	void Draw(const char* title, bool* p_open, ImVec2 size, uint16_t pc);
+
+private:
+	SimZ80DisasmCache_Entry entries[0x10000];
+	uint8_t rom[0xC000];
+	bool rom_loaded[0xC000];
+	int code_count;
+
+	std::vector<uint16_t> rows;		// Code addresses in order, for the listing
+	int rows_code_count;
+	bool follow_pc;
+	char goto_text[5];
+	int scroll_row;
+
+	bool Mapped(uint16_t address);
+	uint8_t Read(uint16_t address);
+	void Decode(uint16_t pc, SimZ80DisasmCache_Entry& entry);
+};
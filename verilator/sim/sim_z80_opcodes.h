@@ -0,0 +1,1816 @@
+#pragma once
+// Generated by z80_opcodes.py from z80_opcodes.csv - do not edit
+#include "sim_z80_disasm.h"
+
+static constexpr SimZ80_Opcode simz80_base[256] = {
+	{ { "nop", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// 00 nop
+	{ { "ld   bc,", "", "" }, { SimZ80_OperandWord, SimZ80_OperandNone }, false, 10, 0 },	// 01 ld   bc,&0000
+	{ { "ld   (bc),a", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 7, 0 },	// 02 ld   (bc),a
+	{ { "inc  bc", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 6, 0 },	// 03 inc  bc
+	{ { "inc  b", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// 04 inc  b
+	{ { "dec  b", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// 05 dec  b
+	{ { "ld   b,", "", "" }, { SimZ80_OperandByte, SimZ80_OperandNone }, false, 7, 0 },	// 06 ld   b,&00
+	{ { "rlca", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// 07 rlca
+	{ { "ex   af,af'", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// 08 ex   af,af'
+	{ { "add  hl,bc", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 11, 0 },	// 09 add  hl,bc
+	{ { "ld   a,(bc)", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 7, 0 },	// 0a ld   a,(bc)
+	{ { "dec  bc", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 6, 0 },	// 0b dec  bc
+	{ { "inc  c", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// 0c inc  c
+	{ { "dec  c", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// 0d dec  c
+	{ { "ld   c,", "", "" }, { SimZ80_OperandByte, SimZ80_OperandNone }, false, 7, 0 },	// 0e ld   c,&00
+	{ { "rrca", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// 0f rrca
+	{ { "djnz ", "", "" }, { SimZ80_OperandJump, SimZ80_OperandNone }, false, 8, 13 },	// 10 djnz &4546
+	{ { "ld   de,", "", "" }, { SimZ80_OperandWord, SimZ80_OperandNone }, false, 10, 0 },	// 11 ld   de,&0000
+	{ { "ld   (de),a", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 7, 0 },	// 12 ld   (de),a
+	{ { "inc  de", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 6, 0 },	// 13 inc  de
+	{ { "inc  d", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// 14 inc  d
+	{ { "dec  d", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// 15 dec  d
+	{ { "ld   d,", "", "" }, { SimZ80_OperandByte, SimZ80_OperandNone }, false, 7, 0 },	// 16 ld   d,&00
+	{ { "rla", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// 17 rla
+	{ { "jr   ", "", "" }, { SimZ80_OperandJump, SimZ80_OperandNone }, false, 12, 0 },	// 18 jr   &4546
+	{ { "add  hl,de", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 11, 0 },	// 19 add  hl,de
+	{ { "ld   a,(de)", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 7, 0 },	// 1a ld   a,(de)
+	{ { "dec  de", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 6, 0 },	// 1b dec  de
+	{ { "inc  e", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// 1c inc  e
+	{ { "dec  e", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// 1d dec  e
+	{ { "ld   e,", "", "" }, { SimZ80_OperandByte, SimZ80_OperandNone }, false, 7, 0 },	// 1e ld   e,&00
+	{ { "rra", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// 1f rra
+	{ { "jr   nz,", "", "" }, { SimZ80_OperandJump, SimZ80_OperandNone }, false, 7, 12 },	// 20 jr   nz,&4546
+	{ { "ld   hl,", "", "" }, { SimZ80_OperandWord, SimZ80_OperandNone }, false, 10, 0 },	// 21 ld   hl,&0000
+	{ { "ld   (", "),hl", "" }, { SimZ80_OperandWord, SimZ80_OperandNone }, false, 16, 0 },	// 22 ld   (&0000),hl
+	{ { "inc  hl", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 6, 0 },	// 23 inc  hl
+	{ { "inc  h", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// 24 inc  h
+	{ { "dec  h", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// 25 dec  h
+	{ { "ld   h,", "", "" }, { SimZ80_OperandByte, SimZ80_OperandNone }, false, 7, 0 },	// 26 ld   h,&00
+	{ { "daa", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// 27 daa
+	{ { "jr   z,", "", "" }, { SimZ80_OperandJump, SimZ80_OperandNone }, false, 7, 12 },	// 28 jr   z,&4546
+	{ { "add  hl,hl", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 11, 0 },	// 29 add  hl,hl
+	{ { "ld   hl,(", ")", "" }, { SimZ80_OperandWord, SimZ80_OperandNone }, false, 16, 0 },	// 2a ld   hl,(&0000)
+	{ { "dec  hl", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 6, 0 },	// 2b dec  hl
+	{ { "inc  l", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// 2c inc  l
+	{ { "dec  l", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// 2d dec  l
+	{ { "ld   l,", "", "" }, { SimZ80_OperandByte, SimZ80_OperandNone }, false, 7, 0 },	// 2e ld   l,&00
+	{ { "cpl", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// 2f cpl
+	{ { "jr   nc,", "", "" }, { SimZ80_OperandJump, SimZ80_OperandNone }, false, 7, 12 },	// 30 jr   nc,&4546
+	{ { "ld   sp,", "", "" }, { SimZ80_OperandWord, SimZ80_OperandNone }, false, 10, 0 },	// 31 ld   sp,&0000
+	{ { "ld   (", "),a", "" }, { SimZ80_OperandWord, SimZ80_OperandNone }, false, 13, 0 },	// 32 ld   (&0000),a
+	{ { "inc  sp", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 6, 0 },	// 33 inc  sp
+	{ { "inc  (hl)", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 11, 0 },	// 34 inc  (hl)
+	{ { "dec  (hl)", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 11, 0 },	// 35 dec  (hl)
+	{ { "ld   (hl),", "", "" }, { SimZ80_OperandByte, SimZ80_OperandNone }, false, 10, 0 },	// 36 ld   (hl),&00
+	{ { "scf", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// 37 scf
+	{ { "jr   c,", "", "" }, { SimZ80_OperandJump, SimZ80_OperandNone }, false, 7, 12 },	// 38 jr   c,&4546
+	{ { "add  hl,sp", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 11, 0 },	// 39 add  hl,sp
+	{ { "ld   a,(", ")", "" }, { SimZ80_OperandWord, SimZ80_OperandNone }, false, 13, 0 },	// 3a ld   a,(&0000)
+	{ { "dec  sp", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 6, 0 },	// 3b dec  sp
+	{ { "inc  a", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// 3c inc  a
+	{ { "dec  a", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// 3d dec  a
+	{ { "ld   a,", "", "" }, { SimZ80_OperandByte, SimZ80_OperandNone }, false, 7, 0 },	// 3e ld   a,&00
+	{ { "ccf", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// 3f ccf
+	{ { "ld   b,b", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// 40 ld   b,b
+	{ { "ld   b,c", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// 41 ld   b,c
+	{ { "ld   b,d", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// 42 ld   b,d
+	{ { "ld   b,e", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// 43 ld   b,e
+	{ { "ld   b,h", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// 44 ld   b,h
+	{ { "ld   b,l", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// 45 ld   b,l
+	{ { "ld   b,(hl)", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 7, 0 },	// 46 ld   b,(hl)
+	{ { "ld   b,a", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// 47 ld   b,a
+	{ { "ld   c,b", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// 48 ld   c,b
+	{ { "ld   c,c", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// 49 ld   c,c
+	{ { "ld   c,d", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// 4a ld   c,d
+	{ { "ld   c,e", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// 4b ld   c,e
+	{ { "ld   c,h", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// 4c ld   c,h
+	{ { "ld   c,l", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// 4d ld   c,l
+	{ { "ld   c,(hl)", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 7, 0 },	// 4e ld   c,(hl)
+	{ { "ld   c,a", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// 4f ld   c,a
+	{ { "ld   d,b", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// 50 ld   d,b
+	{ { "ld   d,c", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// 51 ld   d,c
+	{ { "ld   d,d", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// 52 ld   d,d
+	{ { "ld   d,e", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// 53 ld   d,e
+	{ { "ld   d,h", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// 54 ld   d,h
+	{ { "ld   d,l", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// 55 ld   d,l
+	{ { "ld   d,(hl)", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 7, 0 },	// 56 ld   d,(hl)
+	{ { "ld   d,a", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// 57 ld   d,a
+	{ { "ld   e,b", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// 58 ld   e,b
+	{ { "ld   e,c", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// 59 ld   e,c
+	{ { "ld   e,d", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// 5a ld   e,d
+	{ { "ld   e,e", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// 5b ld   e,e
+	{ { "ld   e,h", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// 5c ld   e,h
+	{ { "ld   e,l", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// 5d ld   e,l
+	{ { "ld   e,(hl)", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 7, 0 },	// 5e ld   e,(hl)
+	{ { "ld   e,a", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// 5f ld   e,a
+	{ { "ld   h,b", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// 60 ld   h,b
+	{ { "ld   h,c", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// 61 ld   h,c
+	{ { "ld   h,d", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// 62 ld   h,d
+	{ { "ld   h,e", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// 63 ld   h,e
+	{ { "ld   h,h", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// 64 ld   h,h
+	{ { "ld   h,l", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// 65 ld   h,l
+	{ { "ld   h,(hl)", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 7, 0 },	// 66 ld   h,(hl)
+	{ { "ld   h,a", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// 67 ld   h,a
+	{ { "ld   l,b", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// 68 ld   l,b
+	{ { "ld   l,c", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// 69 ld   l,c
+	{ { "ld   l,d", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// 6a ld   l,d
+	{ { "ld   l,e", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// 6b ld   l,e
+	{ { "ld   l,h", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// 6c ld   l,h
+	{ { "ld   l,l", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// 6d ld   l,l
+	{ { "ld   l,(hl)", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 7, 0 },	// 6e ld   l,(hl)
+	{ { "ld   l,a", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// 6f ld   l,a
+	{ { "ld   (hl),b", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 7, 0 },	// 70 ld   (hl),b
+	{ { "ld   (hl),c", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 7, 0 },	// 71 ld   (hl),c
+	{ { "ld   (hl),d", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 7, 0 },	// 72 ld   (hl),d
+	{ { "ld   (hl),e", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 7, 0 },	// 73 ld   (hl),e
+	{ { "ld   (hl),h", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 7, 0 },	// 74 ld   (hl),h
+	{ { "ld   (hl),l", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 7, 0 },	// 75 ld   (hl),l
+	{ { "halt", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// 76 halt
+	{ { "ld   (hl),a", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 7, 0 },	// 77 ld   (hl),a
+	{ { "ld   a,b", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// 78 ld   a,b
+	{ { "ld   a,c", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// 79 ld   a,c
+	{ { "ld   a,d", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// 7a ld   a,d
+	{ { "ld   a,e", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// 7b ld   a,e
+	{ { "ld   a,h", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// 7c ld   a,h
+	{ { "ld   a,l", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// 7d ld   a,l
+	{ { "ld   a,(hl)", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 7, 0 },	// 7e ld   a,(hl)
+	{ { "ld   a,a", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// 7f ld   a,a
+	{ { "add  a,b", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// 80 add  a,b
+	{ { "add  a,c", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// 81 add  a,c
+	{ { "add  a,d", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// 82 add  a,d
+	{ { "add  a,e", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// 83 add  a,e
+	{ { "add  a,h", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// 84 add  a,h
+	{ { "add  a,l", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// 85 add  a,l
+	{ { "add  a,(hl)", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 7, 0 },	// 86 add  a,(hl)
+	{ { "add  a,a", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// 87 add  a,a
+	{ { "adc  a,b", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// 88 adc  a,b
+	{ { "adc  a,c", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// 89 adc  a,c
+	{ { "adc  a,d", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// 8a adc  a,d
+	{ { "adc  a,e", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// 8b adc  a,e
+	{ { "adc  a,h", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// 8c adc  a,h
+	{ { "adc  a,l", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// 8d adc  a,l
+	{ { "adc  a,(hl)", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 7, 0 },	// 8e adc  a,(hl)
+	{ { "adc  a,a", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// 8f adc  a,a
+	{ { "sub  b", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// 90 sub  b
+	{ { "sub  c", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// 91 sub  c
+	{ { "sub  d", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// 92 sub  d
+	{ { "sub  e", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// 93 sub  e
+	{ { "sub  h", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// 94 sub  h
+	{ { "sub  l", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// 95 sub  l
+	{ { "sub  a,(hl)", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 7, 0 },	// 96 sub  a,(hl)
+	{ { "sub  a", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// 97 sub  a
+	{ { "sbc  a,b", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// 98 sbc  a,b
+	{ { "sbc  a,c", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// 99 sbc  a,c
+	{ { "sbc  a,d", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// 9a sbc  a,d
+	{ { "sbc  a,e", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// 9b sbc  a,e
+	{ { "sbc  a,h", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// 9c sbc  a,h
+	{ { "sbc  a,l", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// 9d sbc  a,l
+	{ { "sbc  a,(hl)", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 7, 0 },	// 9e sbc  a,(hl)
+	{ { "sbc  a,a", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// 9f sbc  a,a
+	{ { "and  b", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// a0 and  b
+	{ { "and  c", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// a1 and  c
+	{ { "and  d", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// a2 and  d
+	{ { "and  e", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// a3 and  e
+	{ { "and  h", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// a4 and  h
+	{ { "and  l", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// a5 and  l
+	{ { "and  (hl)", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 7, 0 },	// a6 and  (hl)
+	{ { "and  a", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// a7 and  a
+	{ { "xor  b", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// a8 xor  b
+	{ { "xor  c", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// a9 xor  c
+	{ { "xor  d", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// aa xor  d
+	{ { "xor  e", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// ab xor  e
+	{ { "xor  h", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// ac xor  h
+	{ { "xor  l", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// ad xor  l
+	{ { "xor  (hl)", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 7, 0 },	// ae xor  (hl)
+	{ { "xor  a", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// af xor  a
+	{ { "or   b", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// b0 or   b
+	{ { "or   c", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// b1 or   c
+	{ { "or   d", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// b2 or   d
+	{ { "or   e", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// b3 or   e
+	{ { "or   h", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// b4 or   h
+	{ { "or   l", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// b5 or   l
+	{ { "or   (hl)", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 7, 0 },	// b6 or   (hl)
+	{ { "or   a", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// b7 or   a
+	{ { "cp   b", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// b8 cp   b
+	{ { "cp   c", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// b9 cp   c
+	{ { "cp   d", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// ba cp   d
+	{ { "cp   e", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// bb cp   e
+	{ { "cp   h", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// bc cp   h
+	{ { "cp   l", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// bd cp   l
+	{ { "cp   (hl)", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 7, 0 },	// be cp   (hl)
+	{ { "cp   a", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// bf cp   a
+	{ { "ret  nz", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 5, 11 },	// c0 ret  nz
+	{ { "pop  bc", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 10, 0 },	// c1 pop  bc
+	{ { "jp   nz,", "", "" }, { SimZ80_OperandWord, SimZ80_OperandNone }, false, 10, 0 },	// c2 jp   nz,&0000
+	{ { "jp   ", "", "" }, { SimZ80_OperandWord, SimZ80_OperandNone }, false, 10, 0 },	// c3 jp   &0000
+	{ { "call nz,", "", "" }, { SimZ80_OperandWord, SimZ80_OperandNone }, false, 10, 17 },	// c4 call nz,&0000
+	{ { "push bc", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 11, 0 },	// c5 push bc
+	{ { "add  a,", "", "" }, { SimZ80_OperandByte, SimZ80_OperandNone }, false, 7, 0 },	// c6 add  a,&00
+	{ { "rst  ", "", "" }, { SimZ80_OperandByte, SimZ80_OperandNone }, false, 11, 0 },	// c7 rst  &00
+	{ { "ret  z", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 5, 11 },	// c8 ret  z
+	{ { "ret", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 10, 0 },	// c9 ret
+	{ { "jp   z,", "", "" }, { SimZ80_OperandWord, SimZ80_OperandNone }, false, 10, 0 },	// ca jp   z,&0000
+	{ { "**** cb", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, true, 0, 0 },	// cb **** cb
+	{ { "call z,", "", "" }, { SimZ80_OperandWord, SimZ80_OperandNone }, false, 10, 17 },	// cc call z,&0000
+	{ { "call ", "", "" }, { SimZ80_OperandWord, SimZ80_OperandNone }, false, 17, 0 },	// cd call &0000
+	{ { "adc  a,", "", "" }, { SimZ80_OperandByte, SimZ80_OperandNone }, false, 7, 0 },	// ce adc  a,&00
+	{ { "rst  &08", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 11, 0 },	// cf rst  &08
+	{ { "ret  nc", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 5, 11 },	// d0 ret  nc
+	{ { "pop  de", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 10, 0 },	// d1 pop  de
+	{ { "jp   nc,", "", "" }, { SimZ80_OperandWord, SimZ80_OperandNone }, false, 10, 0 },	// d2 jp   nc,&0000
+	{ { "out  (", "),a", "" }, { SimZ80_OperandByte, SimZ80_OperandNone }, false, 11, 0 },	// d3 out  (&00),a
+	{ { "call nc,", "", "" }, { SimZ80_OperandWord, SimZ80_OperandNone }, false, 10, 17 },	// d4 call nc,&0000
+	{ { "push de", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 11, 0 },	// d5 push de
+	{ { "sub  ", "", "" }, { SimZ80_OperandByte, SimZ80_OperandNone }, false, 7, 0 },	// d6 sub  &00
+	{ { "rst  &10", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 11, 0 },	// d7 rst  &10
+	{ { "ret  c", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 5, 11 },	// d8 ret  c
+	{ { "exx", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// d9 exx
+	{ { "jp   c,", "", "" }, { SimZ80_OperandWord, SimZ80_OperandNone }, false, 10, 0 },	// da jp   c,&0000
+	{ { "in   a,(", ")", "" }, { SimZ80_OperandByte, SimZ80_OperandNone }, false, 11, 0 },	// db in   a,(&00)
+	{ { "call c,", "", "" }, { SimZ80_OperandWord, SimZ80_OperandNone }, false, 10, 17 },	// dc call c,&0000
+	{ { "**** dd", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, true, 0, 0 },	// dd **** dd
+	{ { "sbc  a,", "", "" }, { SimZ80_OperandByte, SimZ80_OperandNone }, false, 7, 0 },	// de sbc  a,&00
+	{ { "rst  &18", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 11, 0 },	// df rst  &18
+	{ { "ret  po", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 5, 11 },	// e0 ret  po
+	{ { "pop  hl", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 10, 0 },	// e1 pop  hl
+	{ { "jp   po,", "", "" }, { SimZ80_OperandWord, SimZ80_OperandNone }, false, 10, 0 },	// e2 jp   po,&0000
+	{ { "ex   (sp),hl", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 19, 0 },	// e3 ex   (sp),hl
+	{ { "call po,", "", "" }, { SimZ80_OperandWord, SimZ80_OperandNone }, false, 10, 17 },	// e4 call po,&0000
+	{ { "push hl", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 11, 0 },	// e5 push hl
+	{ { "and  ", "", "" }, { SimZ80_OperandByte, SimZ80_OperandNone }, false, 7, 0 },	// e6 and  &00
+	{ { "rst  &20", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 11, 0 },	// e7 rst  &20
+	{ { "ret  pe", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 5, 11 },	// e8 ret  pe
+	{ { "jp   (hl)", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// e9 jp   (hl)
+	{ { "jp   pe,", "", "" }, { SimZ80_OperandWord, SimZ80_OperandNone }, false, 10, 0 },	// ea jp   pe,&0000
+	{ { "ex   de,hl", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// eb ex   de,hl
+	{ { "call pe,", "", "" }, { SimZ80_OperandWord, SimZ80_OperandNone }, false, 10, 17 },	// ec call pe,&0000
+	{ { "**** ed", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, true, 0, 0 },	// ed **** ed
+	{ { "xor  ", "", "" }, { SimZ80_OperandByte, SimZ80_OperandNone }, false, 7, 0 },	// ee xor  &00
+	{ { "rst  &28", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 11, 0 },	// ef rst  &28
+	{ { "ret  p", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 5, 11 },	// f0 ret  p
+	{ { "pop  af", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 10, 0 },	// f1 pop  af
+	{ { "jp   p,", "", "" }, { SimZ80_OperandWord, SimZ80_OperandNone }, false, 10, 0 },	// f2 jp   p,&0000
+	{ { "di", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// f3 di
+	{ { "call p,", "", "" }, { SimZ80_OperandWord, SimZ80_OperandNone }, false, 10, 17 },	// f4 call p,&0000
+	{ { "push af", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 11, 0 },	// f5 push af
+	{ { "or   ", "", "" }, { SimZ80_OperandByte, SimZ80_OperandNone }, false, 7, 0 },	// f6 or   &00
+	{ { "rst  &30", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 11, 0 },	// f7 rst  &30
+	{ { "ret  m", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 5, 11 },	// f8 ret  m
+	{ { "ld   sp,hl", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 6, 0 },	// f9 ld   sp,hl
+	{ { "jp   m,", "", "" }, { SimZ80_OperandWord, SimZ80_OperandNone }, false, 10, 0 },	// fa jp   m,&0000
+	{ { "ei", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 4, 0 },	// fb ei
+	{ { "call m,", "", "" }, { SimZ80_OperandWord, SimZ80_OperandNone }, false, 10, 17 },	// fc call m,&0000
+	{ { "**** fd", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, true, 0, 0 },	// fd **** fd
+	{ { "cp   ", "", "" }, { SimZ80_OperandByte, SimZ80_OperandNone }, false, 7, 0 },	// fe cp   &00
+	{ { "rst  &38", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 11, 0 },	// ff rst  &38
+};
+
+static constexpr SimZ80_Opcode simz80_cb[256] = {
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 15, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 15, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { "rl   d", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },	// 12 rl   d
+	{ { "rl   e", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },	// 13 rl   e
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 15, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { "rr   c", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },	// 19 rr   c
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { "rr   (hl)", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 15, 0 },	// 1e rr   (hl)
+	{ { "bit  1,a", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },	// 1f bit  1,a
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { "sla  e", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },	// 23 sla  e
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 15, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 15, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 15, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 15, 0 },
+	{ { "srl  a", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },	// 3f srl  a
+	{ { "bit  0,b", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },	// 40 bit  0,b
+	{ { "bit  0,c", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },	// 41 bit  0,c
+	{ { "bit  0,d", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },	// 42 bit  0,d
+	{ { "bit  0,e", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },	// 43 bit  0,e
+	{ { "bit  0,h", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },	// 44 bit  0,h
+	{ { "bit  0,l", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },	// 45 bit  0,l
+	{ { "bit  0,(ix+", ")", "" }, { SimZ80_OperandByte, SimZ80_OperandNone }, false, 12, 0 },	// 46 bit  0,(ix+&00)
+	{ { "bit  0,a", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },	// 47 bit  0,a
+	{ { "bit  1,b", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },	// 48 bit  1,b
+	{ { "bit  1,c", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },	// 49 bit  1,c
+	{ { "bit  1,d", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },	// 4a bit  1,d
+	{ { "bit  1,e", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },	// 4b bit  1,e
+	{ { "bit  1,h", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },	// 4c bit  1,h
+	{ { "bit  1,l", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },	// 4d bit  1,l
+	{ { "bit  1,(ix+", ")", "" }, { SimZ80_OperandByte, SimZ80_OperandNone }, false, 12, 0 },	// 4e bit  1,(ix+&00)
+	{ { "bit  1,a", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },	// 4f bit  1,a
+	{ { "bit  2,b", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },	// 50 bit  2,b
+	{ { "bit  2,c", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },	// 51 bit  2,c
+	{ { "bit  2,d", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },	// 52 bit  2,d
+	{ { "bit  2,e", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },	// 53 bit  2,e
+	{ { "bit  2,h", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },	// 54 bit  2,h
+	{ { "bit  2,l", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },	// 55 bit  2,l
+	{ { "bit  2,(hl)", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 12, 0 },	// 56 bit  2,(hl)
+	{ { "bit  2,a", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },	// 57 bit  2,a
+	{ { "bit  3,b", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },	// 58 bit  3,b
+	{ { "bit  3,c", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },	// 59 bit  3,c
+	{ { "bit  3,d", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },	// 5a bit  3,d
+	{ { "bit  3,e", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },	// 5b bit  3,e
+	{ { "bit  3,h", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },	// 5c bit  3,h
+	{ { "bit  3,l", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },	// 5d bit  3,l
+	{ { "bit  3,(hl)", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 12, 0 },	// 5e bit  3,(hl)
+	{ { "bit  3,a", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },	// 5f bit  3,a
+	{ { "bit  4,b", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },	// 60 bit  4,b
+	{ { "bit  4,c", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },	// 61 bit  4,c
+	{ { "bit  4,d", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },	// 62 bit  4,d
+	{ { "bit  4,e", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },	// 63 bit  4,e
+	{ { "bit  4,h", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },	// 64 bit  4,h
+	{ { "bit  4,l", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },	// 65 bit  4,l
+	{ { "bit  4,(ix+", ")", "" }, { SimZ80_OperandByte, SimZ80_OperandNone }, false, 12, 0 },	// 66 bit  4,(ix+&00)
+	{ { "bit  4,a", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },	// 67 bit  4,a
+	{ { "bit  5,b", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },	// 68 bit  5,b
+	{ { "bit  5,c", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },	// 69 bit  5,c
+	{ { "bit  5,d", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },	// 6a bit  5,d
+	{ { "bit  5,e", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },	// 6b bit  5,e
+	{ { "bit  5,h", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },	// 6c bit  5,h
+	{ { "bit  5,l", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },	// 6d bit  5,l
+	{ { "bit  5,(ix+", ")", "" }, { SimZ80_OperandByte, SimZ80_OperandNone }, false, 12, 0 },	// 6e bit  5,(ix+&00)
+	{ { "bit  5,a", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },	// 6f bit  5,a
+	{ { "bit  6,b", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },	// 70 bit  6,b
+	{ { "bit  6,c", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },	// 71 bit  6,c
+	{ { "bit  6,d", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },	// 72 bit  6,d
+	{ { "bit  6,e", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },	// 73 bit  6,e
+	{ { "bit  6,h", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },	// 74 bit  6,h
+	{ { "bit  6,l", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },	// 75 bit  6,l
+	{ { "bit  6,(ix+", ")", "" }, { SimZ80_OperandByte, SimZ80_OperandNone }, false, 12, 0 },	// 76 bit  6,(ix+&00)
+	{ { "bit  6,a", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },	// 77 bit  6,a
+	{ { "bit  7,b", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },	// 78 bit  7,b
+	{ { "bit  7,c", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },	// 79 bit  7,c
+	{ { "bit  7,d", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },	// 7a bit  7,d
+	{ { "bit  7,e", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },	// 7b bit  7,e
+	{ { "bit  7,h", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },	// 7c bit  7,h
+	{ { "bit  7,l", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },	// 7d bit  7,l
+	{ { "bit  7,(hl)", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 12, 0 },	// 7e bit  7,(hl)
+	{ { "bit  7,a", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },	// 7f bit  7,a
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { "res  0,(hl)", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 15, 0 },	// 86 res  0,(hl)
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { "res  1,(ix+$00)", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 15, 0 },	// 8e res  1,(ix+$00)
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { "res  2,(ix+$00)", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 15, 0 },	// 96 res  2,(ix+$00)
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { "res  3,(iy+$00)", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 15, 0 },	// 9e res  3,(iy+$00)
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { "res  4,(hl)", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 15, 0 },	// a6 res  4,(hl)
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { "res  5,e", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },	// ab res  5,e
+	{ { "res  5,h", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },	// ac res  5,h
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 15, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 15, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 15, 0 },
+	{ { "res  7,a", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },	// bf res  7,a
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 15, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 15, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 15, 0 },
+	{ { "set  2,a", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },	// d7 set  2,a
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { "bit  0,(ix+d)", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },	// dd bit  0,(ix+d)
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 15, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 15, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 15, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { "set  6,(ix+", ")", "" }, { SimZ80_OperandByte, SimZ80_OperandNone }, false, 15, 0 },	// f6 set  6,(ix+&00)
+	{ { "set  6,a", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },	// f7 set  6,a
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { "bit  0,(iy+d)", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },	// fd bit  0,(iy+d)
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 15, 0 },
+	{ { "set  7,a", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },	// ff set  7,a
+};
+
+static constexpr SimZ80_Opcode simz80_ed[256] = {
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 12, 0 },
+	{ { "out  (c),b", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 12, 0 },	// 41 out  (c),b
+	{ { "sbc  hl,bc", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 15, 0 },	// 42 sbc  hl,bc
+	{ { "ld   (", "),bc", "" }, { SimZ80_OperandWord, SimZ80_OperandNone }, false, 20, 0 },	// 43 ld   (&0000),bc
+	{ { "neg", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },	// 44 neg
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 14, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 9, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 12, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 12, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 15, 0 },
+	{ { "ld   bc,(", ")", "" }, { SimZ80_OperandWord, SimZ80_OperandNone }, false, 20, 0 },	// 4b ld   bc,(&0000)
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 14, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 9, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 12, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 12, 0 },
+	{ { "sbc  hl,de", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 15, 0 },	// 52 sbc  hl,de
+	{ { "ld   (", "),de", "" }, { SimZ80_OperandWord, SimZ80_OperandNone }, false, 20, 0 },	// 53 ld   (&0000),de
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 14, 0 },
+	{ { "im   1", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },	// 56 im   1
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 9, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 12, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 12, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 15, 0 },
+	{ { "ld   de,(", ")", "" }, { SimZ80_OperandWord, SimZ80_OperandNone }, false, 20, 0 },	// 5b ld   de,(&0000)
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 14, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { "ld   a,r", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 9, 0 },	// 5f ld   a,r
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 12, 0 },
+	{ { "out   (c),h", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 12, 0 },	// 61 out   (c),h
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 15, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 14, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 18, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 12, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 12, 0 },
+	{ { "adc  hl,hl", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 15, 0 },	// 6a adc  hl,hl
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 14, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { "rld  (hl)", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 18, 0 },	// 6f rld  (hl)
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 12, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 12, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 15, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 14, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { "in   a,(c)", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 12, 0 },	// 78 in   a,(c)
+	{ { "out  (c),a", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 12, 0 },	// 79 out  (c),a
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 15, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 14, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 16, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 16, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 16, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 16, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 16, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 16, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 16, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 16, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { "ldir", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 16, 21 },	// b0 ldir
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 16, 21 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 16, 21 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 16, 21 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { "lddr", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 16, 21 },	// b8 lddr
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 16, 21 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 16, 21 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 16, 21 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+};
+
+static constexpr SimZ80_Opcode simz80_dd[256] = {
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 14, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 11, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 10, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 11, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { "add  ix,bc", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 15, 0 },	// 09 add  ix,bc
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 11, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 10, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 11, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 12, 17 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 14, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 11, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 10, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 11, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 16, 0 },
+	{ { "add  ix,de", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 15, 0 },	// 19 add  ix,de
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 11, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 10, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 11, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 11, 16 },
+	{ { "ld   ix,", "", "" }, { SimZ80_OperandWord, SimZ80_OperandNone }, false, 14, 0 },	// 21 ld   ix,&0000
+	{ { "ld   (hhll),ix", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },	// 22 ld   (hhll),ix
+	{ { "inc  ix", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 10, 0 },	// 23 inc  ix
+	{ { "inc  ixh", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },	// 24 inc  ixh
+	{ { "dec  ixh", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },	// 25 dec  ixh
+	{ { "ld   ixh,", "", "" }, { SimZ80_OperandByte, SimZ80_OperandNone }, false, 11, 0 },	// 26 ld   ixh,&00
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 11, 16 },
+	{ { "add   ix,ix", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 15, 0 },	// 29 add   ix,ix
+	{ { "ld   ix,(hhll)", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },	// 2a ld   ix,(hhll)
+	{ { "dec   ix", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 10, 0 },	// 2b dec   ix
+	{ { "inc   ixl", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },	// 2c inc   ixl
+	{ { "dec   ixl", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },	// 2d dec   ixl
+	{ { "ld   ixl,", "", "" }, { SimZ80_OperandByte, SimZ80_OperandNone }, false, 11, 0 },	// 2e ld   ixl,&00
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 11, 16 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 14, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 17, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 10, 0 },
+	{ { "inc   (ix+", ")", "" }, { SimZ80_OperandByte, SimZ80_OperandNone }, false, 23, 0 },	// 34 inc   (ix+&00)
+	{ { "dec   (ix+", ")", "" }, { SimZ80_OperandByte, SimZ80_OperandNone }, false, 23, 0 },	// 35 dec   (ix+&00)
+	{ { "ld   (ix+", "),", "" }, { SimZ80_OperandByte, SimZ80_OperandByte }, false, 19, 0 },	// 36 ld   (ix+&00),&00
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 11, 16 },
+	{ { "add   ix,sp", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 15, 0 },	// 39 add   ix,sp
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 17, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 10, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 11, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { "ld   b,ixh", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },	// 44 ld   b,ixh
+	{ { "ld   b,ixl", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },	// 45 ld   b,ixl
+	{ { "ld   b,(ix+", ")", "" }, { SimZ80_OperandByte, SimZ80_OperandNone }, false, 19, 0 },	// 46 ld   b,(ix+&00)
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { "ld   c,ixh", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },	// 4c ld   c,ixh
+	{ { "ld   c,ixl", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },	// 4d ld   c,ixl
+	{ { "ld   c,(ix+", ")", "" }, { SimZ80_OperandByte, SimZ80_OperandNone }, false, 19, 0 },	// 4e ld   c,(ix+&00)
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { "ld   d,ixh", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },	// 54 ld   d,ixh
+	{ { "ld   d,ixl", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },	// 55 ld   d,ixl
+	{ { "ld   d,(ix+", ")", "" }, { SimZ80_OperandByte, SimZ80_OperandNone }, false, 19, 0 },	// 56 ld   d,(ix+&00)
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { "ld   e,(ix+", ")", "" }, { SimZ80_OperandByte, SimZ80_OperandNone }, false, 19, 0 },	// 5e ld   e,(ix+&00)
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { "ld   ixh,b", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },	// 60 ld   ixh,b
+	{ { "ld   ixh,c", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },	// 61 ld   ixh,c
+	{ { "ld   ixh,d", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },	// 62 ld   ixh,d
+	{ { "ld   ixh,e", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },	// 63 ld   ixh,e
+	{ { "ld   ixh,ixh", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },	// 64 ld   ixh,ixh
+	{ { "ld   ixh,ixl", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },	// 65 ld   ixh,ixl
+	{ { "ld   h,(ix+", ")", "" }, { SimZ80_OperandByte, SimZ80_OperandNone }, false, 19, 0 },	// 66 ld   h,(ix+&00)
+	{ { "ld   ixh,a", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },	// 67 ld   ixh,a
+	{ { "ld   ixl,b", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },	// 68 ld   ixl,b
+	{ { "ld   ixl,c", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },	// 69 ld   ixl,c
+	{ { "ld   ixl,d", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },	// 6a ld   ixl,d
+	{ { "ld   ixl,e", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },	// 6b ld   ixl,e
+	{ { "ld   ixl,ixh", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },	// 6c ld   ixl,ixh
+	{ { "ld   ixl,ixl", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },	// 6d ld   ixl,ixl
+	{ { "ld   l,(ix+", ")", "" }, { SimZ80_OperandByte, SimZ80_OperandNone }, false, 19, 0 },	// 6e ld   l,(ix+&00)
+	{ { "ld   ixl,a", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },	// 6f ld   ixl,a
+	{ { "ld   (ix+", "),b", "" }, { SimZ80_OperandByte, SimZ80_OperandNone }, false, 19, 0 },	// 70 ld   (ix+&00),b
+	{ { "ld   (ix+", "),c", "" }, { SimZ80_OperandByte, SimZ80_OperandNone }, false, 19, 0 },	// 71 ld   (ix+&00),c
+	{ { "ld   (ix+", "),d", "" }, { SimZ80_OperandByte, SimZ80_OperandNone }, false, 19, 0 },	// 72 ld   (ix+&00),d
+	{ { "ld   (ix+", "),e", "" }, { SimZ80_OperandByte, SimZ80_OperandNone }, false, 19, 0 },	// 73 ld   (ix+&00),e
+	{ { "ld   (ix+", "),h", "" }, { SimZ80_OperandByte, SimZ80_OperandNone }, false, 19, 0 },	// 74 ld   (ix+&00),h
+	{ { "ld   (ix+", "),l", "" }, { SimZ80_OperandByte, SimZ80_OperandNone }, false, 19, 0 },	// 75 ld   (ix+&00),l
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { "ld   (ix+", "),a", "" }, { SimZ80_OperandByte, SimZ80_OperandNone }, false, 19, 0 },	// 77 ld   (ix+&00),a
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { "ld   a,ixh", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },	// 7c ld   a,ixh
+	{ { "ld   a,ixl", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },	// 7d ld   a,ixl
+	{ { "ld   a,(ix+", ")", "" }, { SimZ80_OperandByte, SimZ80_OperandNone }, false, 19, 0 },	// 7e ld   a,(ix+&00)
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { "add   a,ixh", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },	// 84 add   a,ixh
+	{ { "add   a,ixl", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },	// 85 add   a,ixl
+	{ { "add   a,(ix+", ")", "" }, { SimZ80_OperandByte, SimZ80_OperandNone }, false, 19, 0 },	// 86 add   a,(ix+&00)
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { "adc   a,ixh", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },	// 8c adc   a,ixh
+	{ { "adc   a,ixl", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },	// 8d adc   a,ixl
+	{ { "adc   a,(ix+", ")", "" }, { SimZ80_OperandByte, SimZ80_OperandNone }, false, 19, 0 },	// 8e adc   a,(ix+&00)
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { "sub   a,ixh", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },	// 94 sub   a,ixh
+	{ { "sub   a,ixl", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },	// 95 sub   a,ixl
+	{ { "sub   a,(ix+", ")", "" }, { SimZ80_OperandByte, SimZ80_OperandNone }, false, 19, 0 },	// 96 sub   a,(ix+&00)
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { "sbc   a,ixh", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },	// 9c sbc   a,ixh
+	{ { "sbc   a,ixl", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },	// 9d sbc   a,ixl
+	{ { "sbc   a,(ix+", ")", "" }, { SimZ80_OperandByte, SimZ80_OperandNone }, false, 19, 0 },	// 9e sbc   a,(ix+&00)
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { "and   ixh", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },	// a4 and   ixh
+	{ { "and   ixl", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },	// a5 and   ixl
+	{ { "and   (ix+", ")", "" }, { SimZ80_OperandByte, SimZ80_OperandNone }, false, 19, 0 },	// a6 and   (ix+&00)
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { "xor   ixh", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },	// ac xor   ixh
+	{ { "xor   ixl", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },	// ad xor   ixl
+	{ { "xor   (ix+", ")", "" }, { SimZ80_OperandByte, SimZ80_OperandNone }, false, 19, 0 },	// ae xor   (ix+&00)
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { "or   ixh", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },	// b4 or   ixh
+	{ { "or   ixl", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },	// b5 or   ixl
+	{ { "or   (ix+", ")", "" }, { SimZ80_OperandByte, SimZ80_OperandNone }, false, 19, 0 },	// b6 or   (ix+&00)
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { "cp   ixh", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },	// bc cp   ixh
+	{ { "cp   ixl", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },	// bd cp   ixl
+	{ { "cp   (ix+", ")", "" }, { SimZ80_OperandByte, SimZ80_OperandNone }, false, 19, 0 },	// be cp   (ix+&00)
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 9, 15 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 14, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 14, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 14, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 14, 21 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 15, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 11, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 15, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 9, 15 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 14, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 14, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 14, 21 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 21, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 11, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 15, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 9, 15 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 14, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 14, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 15, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 14, 21 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 15, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 11, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 15, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 9, 15 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 14, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 15, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 14, 21 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 11, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 15, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 9, 15 },
+	{ { "pop  ix", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 14, 0 },	// e1 pop  ix
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 14, 0 },
+	{ { "ex   (sp),ix", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },	// e3 ex   (sp),ix
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 14, 21 },
+	{ { "push ix", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 15, 0 },	// e5 push ix
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 11, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 15, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 9, 15 },
+	{ { "jp   (ix)", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },	// e9 jp   (ix)
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 14, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 14, 21 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 11, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 15, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 9, 15 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 14, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 14, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 14, 21 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 15, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 11, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 15, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 9, 15 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 10, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 14, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 14, 21 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 11, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 15, 0 },
+};
+
+static constexpr SimZ80_Opcode simz80_fd[256] = {
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 14, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 11, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 10, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 11, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { "add  iy,bc", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 15, 0 },	// 09 add  iy,bc
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 11, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 10, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 11, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 12, 17 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 14, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 11, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 10, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 11, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 16, 0 },
+	{ { "add  iy,de", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 15, 0 },	// 19 add  iy,de
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 11, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 10, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 11, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 11, 16 },
+	{ { "ld   iy,", "", "" }, { SimZ80_OperandWord, SimZ80_OperandNone }, false, 14, 0 },	// 21 ld   iy,&0000
+	{ { "ld   (", "),iy", "" }, { SimZ80_OperandWord, SimZ80_OperandNone }, false, 20, 0 },	// 22 ld   (&0000),iy
+	{ { "inc  iy", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 10, 0 },	// 23 inc  iy
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 11, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 11, 16 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 15, 0 },
+	{ { "ld   iy,(", ")", "" }, { SimZ80_OperandWord, SimZ80_OperandNone }, false, 20, 0 },	// 2a ld   iy,(&0000)
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 10, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 11, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 11, 16 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 14, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 17, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 10, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { "ld   (iy+", "),", "" }, { SimZ80_OperandByte, SimZ80_OperandByte }, false, 19, 0 },	// 36 ld   (iy+&00),&00
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 11, 16 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 15, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 17, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 10, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 11, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { "ld   b,(iy+", ")", "" }, { SimZ80_OperandByte, SimZ80_OperandNone }, false, 19, 0 },	// 46 ld   b,(iy+&00)
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { "ld   c,(iy+", ")", "" }, { SimZ80_OperandByte, SimZ80_OperandNone }, false, 19, 0 },	// 4e ld   c,(iy+&00)
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { "ld   d,(iy+", ")", "" }, { SimZ80_OperandByte, SimZ80_OperandNone }, false, 19, 0 },	// 56 ld   d,(iy+&00)
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { "ld   e,(iy+", ")", "" }, { SimZ80_OperandByte, SimZ80_OperandNone }, false, 19, 0 },	// 5e ld   e,(iy+&00)
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { "ld   h,(iy+", ")", "" }, { SimZ80_OperandByte, SimZ80_OperandNone }, false, 19, 0 },	// 66 ld   h,(iy+&00)
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { "ld   l,(iy+", ")", "" }, { SimZ80_OperandByte, SimZ80_OperandNone }, false, 19, 0 },	// 6e ld   l,(iy+&00)
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 19, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 19, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 19, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 19, 0 },
+	{ { "ld   (iy+", "),h", "" }, { SimZ80_OperandByte, SimZ80_OperandNone }, false, 19, 0 },	// 74 ld   (iy+&00),h
+	{ { "ld   (iy+", "),l", "" }, { SimZ80_OperandByte, SimZ80_OperandNone }, false, 19, 0 },	// 75 ld   (iy+&00),l
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 19, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { "ld   a,(iy+", ")", "" }, { SimZ80_OperandByte, SimZ80_OperandNone }, false, 19, 0 },	// 7e ld   a,(iy+&00)
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 19, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 19, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 19, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 19, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 19, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 19, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 19, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 19, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 9, 15 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 14, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 14, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 14, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 14, 21 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 15, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 11, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 15, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 9, 15 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 14, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 14, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 14, 21 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 21, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 11, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 15, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 9, 15 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 14, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 14, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 15, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 14, 21 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 15, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 11, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 15, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 9, 15 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 14, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 15, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 14, 21 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 11, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 15, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 9, 15 },
+	{ { "pop  iy", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 14, 0 },	// e1 pop  iy
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 14, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 14, 21 },
+	{ { "push iy", "", "" }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 15, 0 },	// e5 push iy
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 11, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 15, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 9, 15 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 14, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 14, 21 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 11, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 15, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 9, 15 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 14, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 14, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 14, 21 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 15, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 11, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 15, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 9, 15 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 10, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 14, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 8, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 14, 21 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 0, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 11, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 15, 0 },
+};
+
+static constexpr SimZ80_Opcode simz80_ddcb[256] = {
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { "bit  2,(ix+", ")", "" }, { SimZ80_OperandByte, SimZ80_OperandNone }, false, 20, 0 },	// 56 bit  2,(ix+&00)
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { "bit  3,(ix+", ")", "" }, { SimZ80_OperandByte, SimZ80_OperandNone }, false, 20, 0 },	// 5e bit  3,(ix+&00)
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { "bit  4,(ix+", ")", "" }, { SimZ80_OperandByte, SimZ80_OperandNone }, false, 20, 0 },	// 66 bit  4,(ix+&00)
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { "bit  7,(ix+", ")", "" }, { SimZ80_OperandByte, SimZ80_OperandNone }, false, 20, 0 },	// 7e bit  7,(ix+&00)
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { "res  1,(ix+", ")", "" }, { SimZ80_OperandByte, SimZ80_OperandNone }, false, 23, 0 },	// 8e res  1,(ix+&00)
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { "res  3,(ix+", ")", "" }, { SimZ80_OperandByte, SimZ80_OperandNone }, false, 23, 0 },	// 9e res  3,(ix+&00)
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { "res  4,(ix+", ")", "" }, { SimZ80_OperandByte, SimZ80_OperandNone }, false, 23, 0 },	// a6 res  4,(ix+&00)
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { "set  2,(ix+", ")", "" }, { SimZ80_OperandByte, SimZ80_OperandNone }, false, 23, 0 },	// d6 set  2,(ix+&00)
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { "set  3,(ix+", ")", "" }, { SimZ80_OperandByte, SimZ80_OperandNone }, false, 23, 0 },	// de set  3,(ix+&00)
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { "set  6,(ix+", ")", "" }, { SimZ80_OperandByte, SimZ80_OperandNone }, false, 23, 0 },	// f6 set  6,(ix+&00)
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+};
+
+static constexpr SimZ80_Opcode simz80_fdcb[256] = {
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 20, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+	{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, 23, 0 },
+};
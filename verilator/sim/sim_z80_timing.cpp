@@ -0,0 +1,226 @@
+#include "sim_z80_timing.h"
+#include "sim_console.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <algorithm>
+
+static DebugConsole console;
+
+static const uint32_t table_prefix[] = { 0x0000, 0x00CB, 0x00ED, 0x00DD, 0x00FD, 0xDDCB, 0xFDCB };
+
+static const double rows_refresh = 0.5;		// Seconds between table rebuilds
+
+static bool Matches(const SimZ80_Opcode* op, uint64_t cycles, uint32_t extra)
+{
+	if (!op || !op->cycles) { return true; }	// Nothing documented to compare against
+	return cycles == op->cycles + extra || (op->cycles_alt && cycles == op->cycles_alt + extra);
+}
+
+SimZ80Timing::SimZ80Timing()
+{
+	enabled = false;
+	rows_time = -rows_refresh;
+	sort_column = 5;
+	sort_ascending = false;
+	outliers_only = false;
+	Reset();
+}
+
+SimZ80Timing::~SimZ80Timing()
+{
+}
+
+int SimZ80Timing::SlotOf(uint32_t opcode)
+{
+	uint32_t prefix = opcode >> 8;
+	for (int t = 0; t < table_count; t++) {
+		if (table_prefix[t] == prefix) { return t * 256 + (opcode & 0xFF); }
+	}
+	return -1;
+}
+
+uint32_t SimZ80Timing::OpcodeOf(int slot)
+{
+	return table_prefix[slot / 256] << 8 | (slot & 0xFF);
+}
+
+void SimZ80Timing::Retire(uint16_t pc, uint8_t ir, uint64_t clocks, bool acknowledge)
+{
+	if (!acknowledge && fetch.Extend(ir)) { return; }
+
+	// Only the IM 1 acknowledge runs a real instruction, rst 38
+	if (started && (!start_acknowledge || fetch.opcode == 0xFF)) {
+		int slot = SlotOf(fetch.opcode);
+		if (slot >= 0) {
+			uint64_t elapsed = clocks - start_clocks;
+			uint32_t cycles = elapsed > 0xFFFFFFFF ? 0xFFFFFFFF : (uint32_t)elapsed;
+			samples[slot]++;
+			total[slot] += elapsed;
+			if (cycles < min[slot]) { min[slot] = cycles; }
+			if (cycles > max[slot]) { max[slot] = cycles; }
+			total_samples++;
+
+			const SimZ80_Opcode* op = SimZ80Disasm::Lookup(fetch.opcode);
+			uint32_t extra = start_acknowledge ? 2 : 0;
+			if (!Matches(op, cycles, extra)) {
+				if (!mismatches[slot]) {
+					outlier_pc[slot] = start_pc;
+					outlier_cycles[slot] = cycles;
+					char text[64];
+					SimZ80Disasm::Format(op, start_pc, NULL, 0, text, sizeof(text));
+					console.AddLog("Z80 timing: %06X %s took %u T-states at %04X, expected %u", fetch.opcode, text, cycles, start_pc, op->cycles + extra);
+				}
+				mismatches[slot]++;
+				total_mismatches++;
+			}
+		}
+	}
+	started = true;
+	start_pc = pc;
+	start_clocks = clocks;
+	start_acknowledge = acknowledge;
+	fetch.Start(ir);
+}
+
+void SimZ80Timing::Reset()
+{
+	memset(samples, 0, sizeof(samples));
+	memset(total, 0, sizeof(total));
+	memset(mismatches, 0, sizeof(mismatches));
+	memset(min, 0xFF, sizeof(min));
+	memset(max, 0, sizeof(max));
+	memset(outlier_pc, 0, sizeof(outlier_pc));
+	memset(outlier_cycles, 0, sizeof(outlier_cycles));
+	total_samples = 0;
+	total_mismatches = 0;
+	started = false;
+	fetch = SimZ80Disasm_Fetch();
+	start_pc = 0;
+	start_clocks = 0;
+	start_acknowledge = false;
+	rows.clear();
+}
+
+bool SimZ80Timing::ExportCSV(const char* filename)
+{
+	FILE* file = fopen(filename, "w");
+	if (!file) {
+		printf("Z80 timing: cannot create %s\n", filename);
+		return false;
+	}
+	fprintf(file, "opcode,disassembly,expected,expected_alt,samples,min,max,mean,mismatches,first_mismatch_pc,first_mismatch_cycles\n");
+	char text[64];
+	for (int slot = 0; slot < slot_count; slot++) {
+		if (!samples[slot]) { continue; }
+		const SimZ80_Opcode* op = SimZ80Disasm::Lookup(OpcodeOf(slot));
+		SimZ80Disasm::Format(op, 0, NULL, 0, text, sizeof(text));
+		fprintf(file, "%06X,\"%s\",%u,%u,%llu,%u,%u,%.2f,%llu,", OpcodeOf(slot), text, op ? op->cycles : 0, op ? op->cycles_alt : 0,
+			(unsigned long long)samples[slot], min[slot], max[slot], (double)total[slot] / samples[slot], (unsigned long long)mismatches[slot]);
+		if (mismatches[slot]) { fprintf(file, "%04X,%u\n", outlier_pc[slot], outlier_cycles[slot]); }
+		else { fprintf(file, ",\n"); }
+	}
+	fclose(file);
+	return true;
+}
+
+void SimZ80Timing::BuildRows()
+{
+	rows.clear();
+	for (int slot = 0; slot < slot_count; slot++) {
+		if (!samples[slot]) { continue; }
+		if (outliers_only && !mismatches[slot]) { continue; }
+		rows.push_back(slot);
+	}
+	SortRows();
+}
+
+void SimZ80Timing::SortRows()
+{
+	int column = sort_column;
+	bool ascending = sort_ascending;
+	std::sort(rows.begin(), rows.end(), [this, column, ascending](int a, int b) {
+		uint64_t va, vb;
+		switch (column) {
+		case 3: va = samples[a]; vb = samples[b]; break;
+		case 4: va = total[a] * 1000 / samples[a]; vb = total[b] * 1000 / samples[b]; break;
+		case 5: va = mismatches[a]; vb = mismatches[b]; break;
+		default: va = OpcodeOf(a); vb = OpcodeOf(b); break;
+		}
+		if (va == vb) { return a < b; }
+		return ascending ? va < vb : va > vb;
+	});
+}
+
+void SimZ80Timing::Draw(const char* title, bool* p_open, ImVec2 size)
+{
+	ImGui::SetNextWindowSize(size, ImGuiCond_Once);
+	if (!ImGui::Begin(title, p_open))
+	{
+		ImGui::End();
+		return;
+	}
+
+	ImGui::Checkbox("Measure", &enabled);
+	ImGui::SameLine();
+	if (ImGui::Checkbox("Outliers only", &outliers_only)) { rows_time = -rows_refresh; }
+	ImGui::SameLine();
+	if (ImGui::SmallButton("Reset")) { Reset(); }
+	ImGui::SameLine();
+	if (ImGui::SmallButton("Export CSV")) { ExportCSV("z80_timing.csv"); }
+	ImGui::SameLine();
+	ImGui::Text("%llu instructions, %llu outliers", (unsigned long long)total_samples, (unsigned long long)total_mismatches);
+
+	if (ImGui::GetTime() - rows_time >= rows_refresh) {
+		BuildRows();
+		rows_time = ImGui::GetTime();
+	}
+	ImGuiTableFlags flags = ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingFixedFit | ImGuiTableFlags_Sortable | ImGuiTableFlags_ScrollY;
+	if (ImGui::BeginTable("timing", 7, flags)) {
+		ImGui::TableSetupScrollFreeze(0, 1);
+		ImGui::TableSetupColumn("Opcode", ImGuiTableColumnFlags_None, 0, 0);
+		ImGui::TableSetupColumn("Disassembly", ImGuiTableColumnFlags_NoSort, 0, 1);
+		ImGui::TableSetupColumn("Expected", ImGuiTableColumnFlags_NoSort, 0, 2);
+		ImGui::TableSetupColumn("Samples", ImGuiTableColumnFlags_PreferSortDescending, 0, 3);
+		ImGui::TableSetupColumn("Min/Mean/Max", ImGuiTableColumnFlags_PreferSortDescending, 0, 4);
+		ImGui::TableSetupColumn("Outliers", ImGuiTableColumnFlags_DefaultSort | ImGuiTableColumnFlags_PreferSortDescending, 0, 5);
+		ImGui::TableSetupColumn("First outlier", ImGuiTableColumnFlags_NoSort | ImGuiTableColumnFlags_WidthStretch, 0, 6);
+		ImGui::TableHeadersRow();
+
+		ImGuiTableSortSpecs* specs = ImGui::TableGetSortSpecs();
+		if (specs && specs->SpecsDirty && specs->SpecsCount > 0) {
+			sort_column = specs->Specs[0].ColumnUserID;
+			sort_ascending = specs->Specs[0].SortDirection == ImGuiSortDirection_Ascending;
+			SortRows();
+			specs->SpecsDirty = false;
+		}
+
+		ImGuiListClipper clipper;
+		clipper.Begin((int)rows.size());
+		char text[64];
+		while (clipper.Step()) {
+			for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; i++) {
+				int slot = rows[i];
+				const SimZ80_Opcode* op = SimZ80Disasm::Lookup(OpcodeOf(slot));
+				SimZ80Disasm::Format(op, 0, NULL, 0, text, sizeof(text));
+				ImGui::TableNextRow();
+				ImGui::TableNextColumn(); ImGui::Text("%06X", OpcodeOf(slot));
+				ImGui::TableNextColumn(); ImGui::TextUnformatted(text);
+				ImGui::TableNextColumn();
+				if (!op || !op->cycles) { ImGui::TextUnformatted("-"); }
+				else if (op->cycles_alt) { ImGui::Text("%u/%u", op->cycles, op->cycles_alt); }
+				else { ImGui::Text("%u", op->cycles); }
+				ImGui::TableNextColumn(); ImGui::Text("%llu", (unsigned long long)samples[slot]);
+				ImGui::TableNextColumn(); ImGui::Text("%u/%.1f/%u", min[slot], (double)total[slot] / samples[slot], max[slot]);
+				ImGui::TableNextColumn();
+				if (mismatches[slot]) { ImGui::TextColored(ImVec4(1.0f, 0.4f, 0.4f, 1.0f), "%llu (%.1f%%)", (unsigned long long)mismatches[slot], mismatches[slot] * 100.0 / samples[slot]); }
+				else { ImGui::TextUnformatted("0"); }
+				ImGui::TableNextColumn();
+				if (mismatches[slot]) { ImGui::Text("%u at %04X", outlier_cycles[slot], outlier_pc[slot]); }
+			}
+		}
+		ImGui::EndTable();
+	}
+
+	ImGui::End();
+}
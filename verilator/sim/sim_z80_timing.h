@@ -0,0 +1,56 @@
+#pragma once
+#include <stdint.h>
+#include <vector>
+#include "imgui.h"
+#include "sim_z80_disasm.h"
+
+// Per opcode T-state accounting against the documented Z80 timings in sim_z80_opcodes.h
+// Retire is called as each opcode is fetched with the running CPU clock enable count, the clocks since the
+// previous fetch are charged to the previous instruction. The first outlier of each opcode is logged.
+// IM 1 interrupt acknowledge is fetched as rst 38 (IR = FF) and takes 2 more T-states than the instruction,
+// IM 2 and NMI acknowledges are fetched as nop (IR = 00) and are not charged to any opcode.
+struct SimZ80Timing {
+public:
+
+	bool enabled;
+
+	SimZ80Timing();
+	~SimZ80Timing();
+	void Retire(uint16_t pc, uint8_t ir, uint64_t clocks, bool acknowledge);	// acknowledge: interrupt or NMI cycle
+	void Reset();
+	void Restart() { started = false; fetch = SimZ80Disasm_Fetch(); }	// Drop the instruction in flight after a reset or rewind
+	bool ExportCSV(const char* filename);
+	void Draw(const char* title, bool* p_open, ImVec2 size);
+
+private:
+	static const int table_count = 7;		// base, CB, ED, DD, FD, DDCB, FDCB
+	static const int slot_count = table_count * 256;
+
+	// Flat per opcode counters, indexed by table * 256 + opcode
+	uint64_t samples[slot_count];
+	uint64_t total[slot_count];
+	uint64_t mismatches[slot_count];
+	uint32_t min[slot_count];
+	uint32_t max[slot_count];
+	uint16_t outlier_pc[slot_count];		// First mismatch
+	uint32_t outlier_cycles[slot_count];
+	uint64_t total_samples;
+	uint64_t total_mismatches;
+
+	bool started;
+	SimZ80Disasm_Fetch fetch;
+	uint16_t start_pc;
+	uint64_t start_clocks;
+	bool start_acknowledge;
+
+	std::vector<int> rows;
+	double rows_time;
+	int sort_column;
+	bool sort_ascending;
+	bool outliers_only;
+
+	static int SlotOf(uint32_t opcode);
+	static uint32_t OpcodeOf(int slot);
+	void BuildRows();
+	void SortRows();
+};
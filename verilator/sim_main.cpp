@@ -18,6 +18,20 @@
 #include "sim_audio.h"
 #include "sim_input.h"
 #include "sim_clock.h"
+#include "sim_metrics.h"
+#include "sim_video_timing.h"
+#include "sim_frame_export.h"
+#include "sim_input_script.h"
+#include "sim_input_movie.h"
+#include "sim_z80_disasm.h"
+#include "sim_trace.h"
+#include "sim_checkpoint.h"
+#include "sim_profiler.h"
+#include "sim_z80_timing.h"
+#include "sim_z80_disasm_cache.h"
+#include "sim_breakpoints.h"
+#include "sim_gdb.h"
+#include "verilated_vcd_c.h"
 
 #include "../imgui/imgui_memory_editor.h"
 //#include "../imgui/ImGuiFileDialog.h"
@@ -31,9 +45,34 @@
 #include <iterator>
 #include <string>
 #include <iomanip>
+#include <chrono>
+#include <thread>
 
 using namespace std;
 
+// CPU instruction tracing and MAME lockstep comparison
+// Off by default, tracing starts once main_time reaches cpu_trace_from (--cpu-trace [cycle], TRACE console command)
+vluint64_t cpu_trace_from = ~(vluint64_t)0;
+vluint64_t cpu_trace_start = ~(vluint64_t)0; // From the command line
+bool cpu_hooks = false; // Tracer, profiler or timing active, checked once per clk_sys cycle
+vluint64_t cpu_clocks = 0; // CPU clock enables (T-states) seen while cpu_hooks is set
+bool cpu_fetch_timed = false; // Current ir_changed already passed to the timing accounting
+
+// Tracer state for the instruction in flight
+unsigned short active_pc;
+unsigned char active_ir;
+unsigned char active_ir_ext;
+unsigned char active_ir_superext;
+bool active_ir_valid = false;
+
+const int ins_size = 48;
+int ins_index = 0;
+int ins_pc[ins_size];
+int ins_in[ins_size];
+int ins_ma[ins_size];
+unsigned char active_ins = 0;
+unsigned char last_acc;
+
 // Simulation control
 // ------------------
 int initialReset = 48;
@@ -43,6 +82,10 @@ int batchSize = 25000000 / 100;
 bool single_step = 0;
 bool multi_step = 0;
 int multi_step_amount = 1024;
+int gui_refresh_rate = 60; // GUI refresh cap in Hz, 0 = redraw on every pass
+std::chrono::steady_clock::time_point gui_last;
+bool headless = false; // Run without window or GUI (--headless)
+int headless_frames = 0; // Stop after this many frames when headless, 0 = run until killed (--frames N)
 
 // Debug GUI 
 // ---------
@@ -51,8 +94,25 @@ const char* windowTitle_Control = "Simulation control";
 const char* windowTitle_DebugLog = "Debug log";
 const char* windowTitle_Video = "VGA output";
 const char* windowTitle_Audio = "Audio output";
+const char* windowTitle_Metrics = "Performance";
+const char* windowTitle_VideoTiming = "Video timing";
+const char* windowTitle_Profiler = "Profiler";
+const char* windowTitle_Timing = "Z80 timing";
+const char* windowTitle_Disassembly = "Disassembly";
+const char* windowTitle_Breakpoints = "Breakpoints";
 bool showDebugLog = true;
+bool showMetrics = true;
+bool showVideoTiming = true;
+bool showProfiler = true;
+bool showTiming = true;
+bool showDisassembly = true;
+bool showBreakpoints = true;
 DebugConsole console;
+const char* log_file_name = NULL; // Stream the debug log to rotating files (--log-file base [--log-compress])
+bool log_file_compress = false;
+const uint64_t log_file_rotate_bytes = 64 << 20;
+const int log_file_keep = 8;
+const unsigned int log_file_window = 10000; // Lines kept in the console while logging to file
 MemoryEditor mem_edit_8;
 MemoryEditor mem_edit_16;
 
@@ -75,6 +135,11 @@ const int input_dbl = 8;
 const int input_diamonds_down = 9;
 const int input_start = 10;
 const int input_play_no = 11;
+SimInputScript input_script; // Replaces the live keyboard when loaded (--input-script file)
+const char* input_script_name = NULL;
+SimInputMovie input_movie; // Records every change of top->inputs (--record-movie file, replay with --play-movie file)
+const char* input_movie_record_name = NULL;
+const char* input_movie_play_name = NULL;
 
 // Verilog module
 // --------------
@@ -89,14 +154,11 @@ int clk_vid_freq = 15468480 * 2;
 int clk_sys_freq = 15468480;
 SimClock clk_vid(1);
 SimClock clk_sys(1);
+vluint64_t eval_count = 0; // Number of model evaluations
 
-void resetSim()
-{
-	main_time = 0;
-	top->RESET = 1;
-	clk_vid.Reset();
-	clk_sys.Reset();
-}
+// Performance metrics
+// -------------------
+SimMetrics metrics(clk_sys_freq, 50.0);
 
 // Video
 // -----
@@ -105,140 +167,257 @@ void resetSim()
 #define VGA_HEIGHT 256
 #define VGA_SCALE_X vga_scale
 #define VGA_SCALE_Y vga_scale
-SimVideo video(VGA_WIDTH, VGA_HEIGHT, VGA_ROTATE);
+#define VGA_BPP 4 // 4 or 8 = capture VDP colour index, 32 = capture RGB output
+SimVideo video(VGA_WIDTH, VGA_HEIGHT, VGA_ROTATE, VGA_BPP);
 float vga_scale = 2.0;
 
+// VDP18 full RGB palette (compat_rgb_g = 0), packed as 0xAABBGGRR
+const uint32_t vdp_palette[16] = {
+	0xFF000000, 0xFF000000, 0xFF42C821, 0xFF78DC5E,
+	0xFFED5554, 0xFFFC767D, 0xFF4D52D4, 0xFFF5EB42,
+	0xFF5455FC, 0xFF7879FF, 0xFF54C1D4, 0xFF80CEE6,
+	0xFF3BB021, 0xFFBA5BC9, 0xFFCCCCCC, 0xFFFFFFFF
+};
+
+// Sync timing analyser - VDP is configured with is_pal_g = 1 in system.v, ce_pix is every 8th clk_sys cycle
+SimVideoTiming video_timing(true, 8);
+
+// Z80 hot spot profiler, counts are charged in clk_sys cycles
+SimProfiler profiler;
+const char* profile_export_name = NULL; // Profile from reset and write a CSV on exit (--profile file)
+
+// Decoded BIOS and cartridge, rebuilt when cartridge_select changes
+// Custom cartridges (cartridge_select 0) are downloaded at run time and are left undecoded
+SimZ80DisasmCache disasm_cache;
+int disasm_cartridge = -1;
+const char* disasm_cartridge_hex[] = { NULL, "roms/advbidng.hex", "roms/advdefnc.hex", "roms/bbuilder.hex", "roms/convent1.hex", "roms/cplay1.hex", "roms/cplay2.hex", "roms/cplay3.hex", "roms/duplict1.hex", "roms/mplay1.hex" };
+
+void updateDisasmCache()
+{
+	if (top->emu__DOT__cartridge_select == disasm_cartridge) { return; }
+	disasm_cartridge = top->emu__DOT__cartridge_select;
+	disasm_cache.Clear();
+	disasm_cache.LoadHex("roms/bios.hex", 0x0000, 0x4000);
+	if (disasm_cartridge < (int)(sizeof(disasm_cartridge_hex) / sizeof(disasm_cartridge_hex[0])) && disasm_cartridge_hex[disasm_cartridge]) {
+		disasm_cache.LoadHex(disasm_cartridge_hex[disasm_cartridge], 0x4000, 0x8000);
+	}
+	disasm_cache.Rebuild();
+}
+
+// Profiler disassembly from the cache, with operands, when the cached instruction is the one that ran
+void disassembleCached(uint16_t pc, uint32_t opcode, char* out, int size)
+{
+	const SimZ80DisasmCache_Entry* entry = disasm_cache.Lookup(pc);
+	if (entry && entry->opcode == opcode) { disasm_cache.Format(pc, out, size); }
+	else { SimZ80Disasm::Format((opcode >> 16) & 0xFF, (opcode >> 8) & 0xFF, opcode & 0xFF, pc, NULL, 0, out, size); }
+}
+
+// Z80 T-states per opcode against the documented timings
+SimZ80Timing timing;
+const char* timing_export_name = NULL; // Measure from reset and write a CSV on exit (--timing file)
+
+bool profiler_hooked = false;
+bool timing_hooked = false;
+
+// ir_changed is only cleared while a hook is active, so a hook switched on mid-run starts from the next fetch
+void updateCpuHooks()
+{
+	bool hooks = cpu_trace_from != ~(vluint64_t)0 || profiler.enabled || timing.enabled;
+	if (hooks && !cpu_hooks) {
+		top->emu__DOT__system__DOT__cpu__DOT__i_tv80_core__DOT__ir_changed = 0;
+		cpu_fetch_timed = false;
+	}
+	if (profiler.enabled && !profiler_hooked) { profiler.Restart(); }
+	if (timing.enabled && !timing_hooked) { timing.Restart(); }
+	profiler_hooked = profiler.enabled;
+	timing_hooked = timing.enabled;
+	cpu_hooks = hooks;
+}
+
+// Shared memory frame export for external tools (--export-frames [name])
+#ifdef WIN32
+const char* frame_export_default = "bbcbc_frames";
+#else
+const char* frame_export_default = "/bbcbc_frames";
+#endif
+const char* frame_export_name = NULL;
+const int frame_export_slots = 4;
+SimFrameExport frame_export;
+
+// Divergence replay - model snapshots are taken every checkpoint interval during lockstep runs, on a MAME diff the
+// nearest earlier one is restored and re-run to the diff with VCD tracing into divergence_vcd_name
+SimCheckpoint checkpoints(8, 1 << 22);
+const char* divergence_vcd_name = "traces/divergence.vcd";
+VerilatedVcdC* divergence_vcd = NULL;
+bool divergence_pending = false;
+bool divergence_replay_done = false;
+vluint64_t divergence_time;
+
 // Audio
 // -----	
 #define DISABLE_AUDIO
 #ifndef DISABLE_AUDIO
 SimAudio audio(clk_sys_freq, true);
+bool audio_pacing = true; // Hold the simulation back while the playback ring is above the high water mark
+float audio_high_water = 0.5f;
 #endif
 
-// MAME debug log
-//#define CPU_DEBUG
-
-#ifdef CPU_DEBUG
 bool log_instructions = true;
 bool stop_on_log_mismatch = true;
 
-std::vector<std::string> log_mame;
-std::vector<std::string> log_cpu;
-long log_index;
+SimTraceFile log_mame;
+long log_index = 0;
 unsigned int ins_count = 0;
+bool log_compare = false; // Reference loaded and tracing started at reset, so log_index is in step with it
+uint16_t log_compare_fields = SimTrace_PC | SimTrace_Text | SimTrace_A | SimTrace_F | SimTrace_B | SimTrace_C | SimTrace_D | SimTrace_E | SimTrace_H | SimTrace_L | SimTrace_IX | SimTrace_IY | SimTrace_SP;
 
 // CPU debug
 std::string tracefilename = "traces/bbcbc.tr";
+bool log_mame_loaded = false;
 bool cpu_sync;
 bool cpu_sync_last;
-std::vector<std::vector<std::string> > opcodes;
-std::map<std::string, std::string> opcode_lookup;
 
-bool writeLog(const char* line)
+bool writeLog(const SimTraceRecord& record, const char* line)
 {
-	// Write to cpu log
-	log_cpu.push_back(line);
+	ins_count++;
+	if (log_instructions) {
+		console.AddLogDeferred("%u > %s ", ins_count, line);
+	}
+	if (!log_compare) { return true; }
 
 	// Compare with MAME log
 	bool match = true;
-	ins_count++;
-
-	std::string c_line = std::string(line);
-	std::string c = "%d > " + c_line + " ";
-
-	unsigned char acc = top->emu__DOT__system__DOT__cpu__DOT__i_tv80_core__DOT__ACC;
-	//c.append(fmt::format(" A={0:02X}", acc));
-
-	if (log_index < log_mame.size()) {
-		std::string m_line = log_mame.at(log_index);
-
-		std::string m_line_lower = m_line.c_str();
-		for (auto& c : m_line_lower) { c = tolower(c); }
-		std::string c_line_lower = c_line.c_str();
-		for (auto& c : c_line_lower) { c = tolower(c); }
-
-		if (log_instructions) {
-			console.AddLog(c.c_str(), ins_count);
-		}
-		if (stop_on_log_mismatch && m_line_lower != c_line_lower) {
+	const SimTraceRecord* mame = log_mame.Get(log_index);
+	if (mame) {
+		uint16_t differ = SimTrace_Compare(*mame, record, log_compare_fields);
+		if (stop_on_log_mismatch && differ) {
 			if (log_instructions) {
-				std::string m = "MAME > " + m_line;
-				console.AddLog(m.c_str());
+				char m_line[256];
+				SimTrace_Describe(*mame, log_mame.Text(mame), m_line, sizeof(m_line));
+				console.AddLogDeferred("MAME > %s", m_line);
 			}
-			console.AddLog("DIFF at %d", log_index);
+			console.AddLogDeferred("DIFF at %ld (fields %04x)", log_index, differ);
 			match = false;
 			run_enable = 0;
+			if (checkpoints.replaying) { divergence_replay_done = true; }
+			else if (!divergence_pending && checkpoints.interval > 0) {
+				divergence_pending = true;
+				divergence_time = main_time;
+			}
 		}
 	}
 	else {
+		// End of the reference, tracing carries on without comparing
 		console.AddLog("MAME OUT");
 		run_enable = 0;
+		log_compare = false;
 	}
 	log_index++;
 	return match;
 }
 
-void loadOpcodes()
+// Start tracing at the given sim time, the reference trace is opened the first time tracing is enabled
+// The reference only lines up with a trace from reset, started mid-run the instructions are logged without comparing
+void startCpuTrace(vluint64_t from)
 {
-	std::string fileName = "z80_opcodes.csv";
-	std::string                           header;
-	std::ifstream                         reader(fileName);
-	if (reader.is_open()) {
-		std::string line, column, id;
-		std::getline(reader, line);
-		header = line;
-		while (std::getline(reader, line)) {
-			std::stringstream        ss(line);
-			std::vector<std::string> columns;
-			bool                     withQ = false;
-			std::string              part{ "" };
-			while (std::getline(ss, column, ',')) {
-				auto pos = column.find("\"");
-				if (pos < column.length()) {
-					withQ = !withQ;
-					part += column.substr(0, pos);
-					column = column.substr(pos + 1, column.length());
-				}
-				if (!withQ) {
-					column += part;
-					columns.emplace_back(std::move(column));
-					part = "";
-				}
-				else {
-					part += column + ",";
-				}
-			}
-			opcodes.push_back(columns);
-			opcode_lookup[columns[0]] = columns[1];
-		}
+	if (!log_mame_loaded) {
+		// Either MAME text or converted with --convert-mame-trace
+		log_mame_loaded = log_mame.Open(tracefilename.c_str());
+		if (!log_mame_loaded) { console.AddLog("CPU trace: no reference trace %s", tracefilename.c_str()); }
 	}
-};
+	cpu_trace_from = from;
+	active_ir_valid = false;
+	ins_index = 0;
+	log_compare = log_mame_loaded && from == 0 && main_time == 0;
+	if (log_compare) {
+		log_index = 0;
+		ins_count = 0;
+	}
+	updateCpuHooks();
+	console.AddLogDeferred("CPU trace: starting at cycle %llu%s", (unsigned long long)from, log_compare ? ", comparing with the reference" : "");
+}
 
-std::string int_to_hex(unsigned char val)
+void stopCpuTrace()
 {
-	std::stringstream ss;
-	ss << std::setfill('0') << std::setw(2) << std::hex << (val | 0);
-	return ss.str();
+	cpu_trace_from = ~(vluint64_t)0;
+	updateCpuHooks();
+	console.AddLog("CPU trace: stopped");
 }
 
-std::string get_opcode(int ir, int ir_ext, int ir_superext)
+void resetSim()
 {
-	std::string hex = "0x";
-	if (ir_superext > 0) {
-		hex.append(int_to_hex(ir_superext));
-	}
-	if (ir_ext > 0) {
-		hex.append(int_to_hex(ir_ext));
+	main_time = 0;
+	top->RESET = 1;
+	clk_vid.Reset();
+	clk_sys.Reset();
+	video_timing.Reset();
+	video.count_frame = 0;
+	input_script.Rewind();
+	input_movie.Restart();
+	input_0.ClearKeyEvents();
+	if (input_script.active) { top->inputs = input_script.inputs; }
+	checkpoints.Clear();
+	profiler.Restart();
+	timing.Restart();
+	// The trace comparison restarts with the sim, a trace in progress carries on from reset
+	log_index = 0;
+	ins_count = 0;
+	if (cpu_trace_from != ~(vluint64_t)0) { startCpuTrace(0); }
+}
+
+// TRACE [ON|OFF|<cycle>]
+void traceCommand(const char* args)
+{
+	char word[8] = { 0 };
+	for (int i = 0; i < 7 && args[i]; i++) { word[i] = (char)toupper((unsigned char)args[i]); }
+	if (!word[0] || !strcmp(word, "ON")) { startCpuTrace(main_time); }
+	else if (!strcmp(word, "OFF")) { stopCpuTrace(); }
+	else if (isdigit((unsigned char)args[0])) { startCpuTrace(strtoull(args, NULL, 0)); }
+	else { console.AddLog("Usage: TRACE [ON|OFF|<cycle>]"); }
+}
+
+// PC breakpoints and memory/IO watchpoints, checked every clk_sys cycle while any are enabled
+SimBreakpoints breakpoints;
+
+void checkBreakpoints()
+{
+	uint16_t address = top->emu__DOT__system__DOT__cpu__DOT__i_tv80_core__DOT__A;
+	uint16_t vram_address = top->emu__DOT__system__DOT__vram_addr;
+	bool fetch = !top->emu__DOT__system__DOT__cpu_m1_n && !top->emu__DOT__system__DOT__cpu_mreq_n;
+	// Every strobe is passed on each cycle so their edge detection stays current
+	bool hit = breakpoints.Access(SimBreakpoint_Exec, fetch, address);
+	hit |= breakpoints.Access(SimBreakpoint_RamRead, top->emu__DOT__system__DOT__ram_read, address);
+	hit |= breakpoints.Access(SimBreakpoint_RamWrite, top->emu__DOT__system__DOT__ram_write, address);
+	hit |= breakpoints.Access(SimBreakpoint_VramRead, top->emu__DOT__system__DOT__vdp__DOT__cpu_io_b__DOT__vram_cpu_read_s, vram_address);
+	hit |= breakpoints.Access(SimBreakpoint_VramWrite, top->emu__DOT__system__DOT__vram_we, vram_address);
+	hit |= breakpoints.Access(SimBreakpoint_IoRead, top->emu__DOT__system__DOT__pio_read || top->emu__DOT__system__DOT__vdp_read, address & 0xFF);
+	hit |= breakpoints.Access(SimBreakpoint_IoWrite, top->emu__DOT__system__DOT__pio_write || top->emu__DOT__system__DOT__vdp_write, address & 0xFF);
+	if (hit) {
+		run_enable = 0;
+		if (!breakpoints.hit_step) { console.AddLog("Breakpoint %s %04X at cycle %llu", SimBreakpoints::TypeName(breakpoints.hit_type), breakpoints.hit_address, (unsigned long long)main_time); }
 	}
-	hex.append(int_to_hex(ir));
-	if (opcode_lookup.find(hex) != opcode_lookup.end()) {
-		return opcode_lookup[hex];
+}
+
+void breakCommand(const char* args)
+{
+	char word[8] = { 0 };
+	char value[16] = { 0 };
+	int count = sscanf(args, "%7s %15s", word, value);
+	for (int i = 0; word[i]; i++) { word[i] = (char)toupper((unsigned char)word[i]); }
+	SimBreakpoint_Type type;
+	if (count <= 0) {
+		for (int i = 0; i < breakpoints.Count(); i++) {
+			const SimBreakpoint& breakpoint = breakpoints.Get(i);
+			console.AddLog("%d: %s %04X%s, %llu hits", i, SimBreakpoints::TypeName(breakpoint.type), breakpoint.address, breakpoint.enabled ? "" : " (disabled)", (unsigned long long)breakpoint.hits);
+		}
 	}
-	else
-	{
-		hex.append(" - MISSING OPCODE");
-		return hex;
+	else if (!strcmp(word, "CLEAR")) { breakpoints.Clear(); }
+	else if (!strcmp(word, "DEL") && count == 2) { breakpoints.Remove(atoi(value)); }
+	else if (SimBreakpoints::ParseType(word, &type) && count == 2) {
+		int index = breakpoints.Add(type, (uint16_t)strtoul(value, NULL, 16));
+		console.AddLog("Breakpoint %d: %s %04X", index, SimBreakpoints::TypeName(type), breakpoints.Get(index).address);
 	}
+	else { console.AddLog("Usage: BREAK [PC|RAMR|RAMW|VRAMR|VRAMW|IOR|IOW <hex address>|DEL <index>|CLEAR]"); }
 }
 
 bool hasEnding(std::string const& fullString, std::string const& ending) {
@@ -254,27 +433,163 @@ std::string last_log;
 
 unsigned short last_pc;
 unsigned short last_last_pc;
-unsigned char last_mreq;
 
-unsigned short active_pc;
-unsigned char active_ir;
-unsigned char active_ir_ext;
-unsigned char active_ir_superext;
-bool active_ir_valid = false;
+bool rom_read_last;
 
-const int ins_size = 48;
-int ins_index = 0;
-int ins_pc[ins_size];
-int ins_in[ins_size];
-int ins_ma[ins_size];
-unsigned char active_ins = 0;
-unsigned char last_acc;
+// Harness side of a checkpoint, everything verilate() and the tracer carry between calls
+void checkpointState(SimCheckpoint_State& state)
+{
+	state.Field(main_time);
+	state.Field(clk_vid);
+	state.Field(clk_sys);
+	state.Field(video.count_frame);
+	state.Field(input_script.inputs);
+	state.Field(input_script.next);
+	state.Field(input_script.next_cycle);
+	state.Field(input_script.next_frame);
+	state.Field(log_index);
+	state.Field(ins_count);
+	state.Field(log_compare);
+	state.Field(last_pc);
+	state.Field(last_last_pc);
+	state.Field(active_pc);
+	state.Field(active_ir);
+	state.Field(active_ir_ext);
+	state.Field(active_ir_superext);
+	state.Field(active_ir_valid);
+	state.Field(ins_index);
+	state.Field(cpu_clocks);
+	state.Field(cpu_fetch_timed);
+	state.Field(ins_pc);
+	state.Field(ins_in);
+	state.Field(ins_ma);
+	state.Field(active_ins);
+	state.Field(last_acc);
+	state.Field(rom_read_last);
+}
 
-bool rom_read_last;
+void takeCheckpoint()
+{
+	SimCheckpoint_Snapshot* snapshot = checkpoints.Take(main_time);
+	SimCheckpoint_Save model(snapshot->model);
+	model << *top;
+	model.close();
+	SimCheckpoint_State state(snapshot->state, true);
+	checkpointState(state);
+}
 
-#endif
 
 
+// Instruction tracer, called on each clk_sys rising edge once main_time reaches cpu_trace_from
+void traceCpu()
+{
+	if (!top->emu__DOT__system__DOT__reset && top->emu__DOT__ce_5m3) {
+
+
+		unsigned short pc = top->emu__DOT__system__DOT__cpu__DOT__i_tv80_core__DOT__PC;
+
+		unsigned char di = top->emu__DOT__system__DOT__cpu__DOT__i_tv80_core__DOT__di;
+		unsigned short ad = top->emu__DOT__system__DOT__cpu__DOT__i_tv80_core__DOT__A;
+		unsigned char ir = top->emu__DOT__system__DOT__cpu__DOT__i_tv80_core__DOT__IR;
+
+		unsigned char acc = top->emu__DOT__system__DOT__cpu__DOT__i_tv80_core__DOT__ACC;
+		bool ir_changed = top->emu__DOT__system__DOT__cpu__DOT__i_tv80_core__DOT__ir_changed;
+
+		bool rom_read = top->emu__DOT__system__DOT__rom_read;
+
+		top->emu__DOT__system__DOT__cpu__DOT__i_tv80_core__DOT__ir_changed = 0;
+
+		// Operand bytes of the instruction in flight, read from ROM after its opcode
+		bool rom_data = (!rom_read && rom_read_last);
+		if (rom_data && !ir_changed) {
+			ins_in[ins_index] = di;
+			ins_index++;
+			if (ins_index > ins_size - 1) { ins_index = 0; }
+		}
+		rom_read_last = rom_read;
+
+		if (ir_changed) {
+			if (active_ir_valid) {
+				if (!SimZ80Disasm::Lookup(0, 0, active_ir)->text[0])
+				{
+					console.AddLogDeferred("No opcode found for %x", active_ir);
+				}
+
+				// Is this a compound opcode?
+				if (SimZ80Disasm::IsPrefix(active_ir))
+				{
+					if (active_ir == 0xDD)
+					{
+						active_ir_superext = active_ir;
+					}
+					else {
+						active_ir_ext = active_ir;
+					}
+				}
+				else {
+					uint8_t data[2] = { (uint8_t)ins_in[0], (uint8_t)ins_in[1] };
+					char buf[1024];
+					int len = snprintf(buf, sizeof(buf), "%04X: ", active_pc);
+					int text_length = SimZ80Disasm::Format(active_ir_superext, active_ir_ext, active_ir, active_pc, data, ins_index, buf + len, sizeof(buf) - len);
+
+					SimTraceRecord record;
+					memset(&record, 0, sizeof(record));
+					record.cycle = main_time;
+					record.pc = active_pc;
+					record.hash = SimTrace_Hash(buf + len, text_length);
+					record.a = last_acc;
+					if (active_ir_superext) { record.opcode[record.length++] = active_ir_superext; }
+					if (active_ir_ext) { record.opcode[record.length++] = active_ir_ext; }
+					record.opcode[record.length++] = active_ir;
+					record.valid = SimTrace_PC | SimTrace_Text | SimTrace_A | SimTrace_Opcode | SimTrace_Cycle;
+					writeLog(record, buf);
+
+					// Clear instruction cache
+					ins_index = 0;
+					for (int i = 0; i < ins_size; i++) {
+						ins_in[i] = 0;
+						ins_ma[i] = 0;
+					}
+					active_ir_ext = 0;
+					active_ir_superext = 0;
+
+					active_pc = ad;
+				}
+				last_acc = acc;
+			}
+			active_ir_valid = true;
+			ins_index = 0;
+			active_ir = ir;
+
+			last_last_pc = last_pc;
+			last_pc = pc;
+		}
+	}
+}
+
+// Instruction level instrumentation, the tracer consumes ir_changed itself when running
+void cpuHooks()
+{
+	if (top->emu__DOT__system__DOT__reset) { return; }
+
+	// T-states are counted on every CPU clock enable, ce_5m3 is too coarse for exact instruction timing.
+	// ir_changed stays set until the ce_5m3 hooks below clear it, so only its first appearance is timed.
+	if (top->emu__DOT__system__DOT__vdp_cpu_clk) { cpu_clocks++; }
+	if (timing.enabled && top->emu__DOT__system__DOT__cpu__DOT__i_tv80_core__DOT__ir_changed && !cpu_fetch_timed) {
+		bool acknowledge = top->emu__DOT__system__DOT__cpu__DOT__i_tv80_core__DOT__IntCycle || top->emu__DOT__system__DOT__cpu__DOT__i_tv80_core__DOT__NMICycle;
+		timing.Retire(top->emu__DOT__system__DOT__cpu__DOT__i_tv80_core__DOT__A, top->emu__DOT__system__DOT__cpu__DOT__i_tv80_core__DOT__IR, cpu_clocks, acknowledge);
+		cpu_fetch_timed = true;
+	}
+
+	if (!top->emu__DOT__ce_5m3) { return; }
+	if (profiler.enabled && top->emu__DOT__system__DOT__cpu__DOT__i_tv80_core__DOT__ir_changed) {
+		profiler.Retire(top->emu__DOT__system__DOT__cpu__DOT__i_tv80_core__DOT__A, top->emu__DOT__system__DOT__cpu__DOT__i_tv80_core__DOT__IR, main_time);
+	}
+	if (main_time >= cpu_trace_from) { traceCpu(); }
+	else { top->emu__DOT__system__DOT__cpu__DOT__i_tv80_core__DOT__ir_changed = 0; }
+	cpu_fetch_timed = false;
+}
+
 int verilate()
 {
 
@@ -300,17 +615,27 @@ int verilate()
 			// Simulate both edges of system clock
 			if (clk_sys.clk != clk_sys.old) {
 				if (clk_sys.clk) {
-					input_0.BeforeEval();
+					if (main_time >= input_script.next_cycle || video.count_frame >= input_script.next_frame) {
+						top->inputs = input_script.Apply(main_time, video.count_frame);
+					}
+					if (main_time >= input_0.next_key_time) { input_0.BeforeEval(main_time); }
 					bus.BeforeEval();
 				}
 				top->eval();
+				eval_count++;
+				if (checkpoints.replaying && divergence_vcd) { divergence_vcd->dump(eval_count); }
 				if (clk_sys.clk) { bus.AfterEval(); }
 			}
 
 			// Output pixels on rising edge of pixel clock
 			if (clk_vid.IsFalling() && top->emu__DOT__ce_pix) {
+#if VGA_BPP == 32
 				uint32_t colour = 0xFF000000 | top->VGA_B << 16 | top->VGA_G << 8 | top->VGA_R;
 				video.Clock(top->VGA_HB, top->VGA_VB, top->VGA_HS, top->VGA_VS, colour);
+#else
+				video.ClockIndexed(top->VGA_HB, top->VGA_VB, top->VGA_HS, top->VGA_VS, top->VGA_COL);
+#endif
+				video_timing.Clock(top->VGA_HB, top->VGA_VB, top->VGA_HS, top->VGA_VS, main_time);
 			}
 
 		}
@@ -324,164 +649,11 @@ int verilate()
 
 
 		if (clk_sys.IsRising()) {
-#ifdef CPU_DEBUG
-			if (!top->emu__DOT__system__DOT__reset && top->emu__DOT__ce_5m3) {
-
-
-				unsigned short pc = top->emu__DOT__system__DOT__cpu__DOT__i_tv80_core__DOT__PC;
-
-				unsigned char di = top->emu__DOT__system__DOT__cpu__DOT__i_tv80_core__DOT__di;
-				unsigned short ad = top->emu__DOT__system__DOT__cpu__DOT__i_tv80_core__DOT__A;
-				unsigned char ir = top->emu__DOT__system__DOT__cpu__DOT__i_tv80_core__DOT__IR;
-
-				unsigned char acc = top->emu__DOT__system__DOT__cpu__DOT__i_tv80_core__DOT__ACC;
-				unsigned char z = top->emu__DOT__system__DOT__cpu__DOT__i_tv80_core__DOT__flag_z;
-
-				unsigned char phi = top->emu__DOT__system__DOT__cpu__DOT__cen;
-				unsigned char mcycle = top->emu__DOT__system__DOT__cpu__DOT__mcycle;
-				unsigned char mreq = top->emu__DOT__system__DOT__cpu__DOT__mreq_n;
-				bool ir_changed = top->emu__DOT__system__DOT__cpu__DOT__i_tv80_core__DOT__ir_changed;
-
-				bool rom_read = top->emu__DOT__system__DOT__rom_read;
-
-				top->emu__DOT__system__DOT__cpu__DOT__i_tv80_core__DOT__ir_changed = 0;
-
-				bool new_data = (mreq && !last_mreq && mcycle <= 4);
-				bool rom_data = (!rom_read && rom_read_last);
-				if ((rom_data) && !ir_changed) {
-					std::string type = "NONE";
-					if (new_data && !rom_data) { type = "NEW_ONLY"; }
-					if (new_data && rom_data) { type = "BOTH_DATA"; }
-					if (!new_data && rom_data) { type = "ROM_ONLY"; }
-					std::string message = "%08d > ";
-					message = message.append(type);
-					message = message.append(" PC=%04x IR=%02x AD=%04x DI=%02x");
-					//console.AddLog(message.c_str(), main_time, pc, ir, ad, di);
-					ins_in[ins_index] = di;
-					ins_index++;
-					if (ins_index > ins_size - 1) { ins_index = 0; }
-				}
-				//console.AddLog("%08d PC=%04x IR=%02x AD=%04x DI=%02x ACC=%d Z=%d ND=%d IRC=%d", main_time, pc, ir, ad, di, acc, z, new_data, ir_changed);
-
-				last_mreq = mreq;
-				rom_read_last = rom_read;
-
-				if (ir_changed) {
-					//console.AddLog("%08d IR_CHANGED> PC=%04x IR=%02x AD=%04x DI=%02x ACC=%x z=%x", main_time, pc, ir, ad, di, acc, z);
-					//console.AddLog("ACTIVE_IR: %x ACTIVE_PC: %x ACtIVE_IR_EXT: %x", active_ir, active_pc, active_ir_ext);
-
-					if (active_ir_valid) {
-						std::string opcode = get_opcode(active_ir, 0, 0);
-
-						if (opcode.c_str() == "")
-						{
-							console.AddLog("No opcode found for %x", active_ir);
-						}
-
-						// Is this a compound opcode?
-						size_t pos = opcode.find("****");
-						if (pos != std::string::npos)
-						{
-							if (active_ir == 0xDD)
-							{
-								//								console.AddLog("SUPER! Compound opcode start: %s", opcode);
-								active_ir_superext = active_ir;
-							}
-							else {
-								//							console.AddLog("Compound opcode start: %s", opcode);
-								active_ir_ext = active_ir;
-							}
-						}
-						else {
-							unsigned char data1 = ins_in[ins_index - 2];
-							unsigned char data2 = ins_in[ins_index - 1];
-							data1 = ins_in[0];
-							data2 = ins_in[1];
-							//std::string fmt = fmt::format("A={0:02X} ", last_acc);
-							std::string fmt;
-							fmt.append("%04X: ");
-							std::string opcode = get_opcode(active_ir, active_ir_ext, active_ir_superext);
-
-							size_t pos = opcode.find("&0000");
-							if (pos != std::string::npos)
-							{
-								//data1 = ins_in[0];
-								//data2 = ins_in[1];
-								//console.AddLog("&0000 %d %x %x %x", ins_index, ins_in[0], ins_in[1], ins_in[2]);
-								char buf[6];
-								sprintf(buf, "$%02X%02X", data2, data1);
-								opcode.replace(pos, 5, buf);
-							}
-
-							pos = opcode.find("&4546");
-							if (pos != std::string::npos)
-							{
-								//console.AddLog("&4546 %d %x %x %x", ins_index, ins_in[0], ins_in[1], ins_in[2]);
-								char buf[6];
-								unsigned char active_data = (ins_index == 1 ? data1 : data2);
-								unsigned short add = active_pc + +2;
-								if (opcode.substr(0, 4) == "djnz") {
-									add = active_pc + ((signed char)active_data) + 2;
-								}
-								if (opcode.substr(0, 4) == "jr  ") {
-									add = active_pc + ((signed char)active_data) + 2;
-								}
-								sprintf(buf, "$%04X", add);
-								opcode.replace(pos, 5, buf);
-							}
-
-							pos = opcode.find("&00");
-							if (pos != std::string::npos)
-							{
-								//console.AddLog("&00 %d %x %x %x", ins_index, ins_in[0], ins_in[1], ins_in[2]);
-								char buf[4];
-								sprintf(buf, "$%02X", ins_in[0]);
-								opcode.replace(pos, 3, buf);
-
-								pos = opcode.find("&00");
-								if (pos != std::string::npos)
-								{
-									sprintf(buf, "$%02X", ins_in[1]);
-									opcode.replace(pos, 3, buf);
-								}
-							}
-
-							fmt.append(opcode);
-							char buf[1024];
-							sprintf(buf, fmt.c_str(), active_pc);
-							writeLog(buf);
-
-							// Clear instruction cache
-							ins_index = 0;
-							for (int i = 0; i < ins_size; i++) {
-								ins_in[i] = 0;
-								ins_ma[i] = 0;
-							}
-							if (active_ir_ext != 0) {
-								active_ir_ext = 0;
-								//		console.AddLog("Compound opcode cleared");
-							}
-							if (active_ir_superext != 0) {
-								active_ir_superext = 0;
-								//		console.AddLog("SUPER! Compound opcode cleared");
-							}
-
-							active_pc = ad;
-						}
-						last_acc = acc;
-					}
-					//console.AddLog("Setting active last_last_pc=%x last_pc=%x pc=%x addr=%x", last_last_pc, last_pc, pc, ad);
-					active_ir_valid = true;
-					ins_index = 0;
-					active_ir = ir;
-
-					last_last_pc = last_pc;
-					last_pc = pc;
-				}
-			}
-#endif
+			if (cpu_hooks) { cpuHooks(); }
+			if (breakpoints.armed) { checkBreakpoints(); }
 			main_time++;
 		}
+		if (main_time >= cpu_trace_from && checkpoints.Due(main_time) && !divergence_pending && !*bus.ioctl_download) { takeCheckpoint(); }
 		return 1;
 	}
 
@@ -492,29 +664,218 @@ int verilate()
 	return 0;
 }
 
+// Re-runs from the checkpoint before the last MAME diff up to the diff again, with instruction logging and VCD tracing
+void replayDivergence()
+{
+	divergence_pending = false;
+	SimCheckpoint_Snapshot* snapshot = checkpoints.Before(divergence_time);
+	if (!snapshot) {
+		console.AddLog("Divergence replay: no checkpoint before %llu", (unsigned long long)divergence_time);
+		return;
+	}
+
+	SimCheckpoint_Restore model(snapshot->model);
+	model >> *top;
+	model.close();
+	SimCheckpoint_State state(snapshot->state, false);
+	checkpointState(state);
+	profiler.Restart();
+	timing.Restart();
+
+	if (!divergence_vcd) {
+		divergence_vcd = new VerilatedVcdC;
+		top->trace(divergence_vcd, 99);
+	}
+	divergence_vcd->open(divergence_vcd_name);
+	console.AddLog("Divergence replay: cycles %llu to %llu into %s", (unsigned long long)snapshot->time, (unsigned long long)divergence_time, divergence_vcd_name);
+
+	bool log_instructions_old = log_instructions;
+	log_instructions = true;
+	checkpoints.replaying = true;
+	divergence_replay_done = false;
+	while (!divergence_replay_done && main_time <= divergence_time) { verilate(); }
+	checkpoints.replaying = false;
+	log_instructions = log_instructions_old;
+	divergence_vcd->close();
+	run_enable = 0;
+}
+
+// GDB remote debugging of the Z80 (--gdb [port]), served from the GUI or headless loop
+#define CPU_CORE(signal) top->emu__DOT__system__DOT__cpu__DOT__i_tv80_core__DOT__##signal
+int gdb_port = 0;
+
+void gdbRegisters(uint16_t* registers)
+{
+	// BC, DE and HL are at 0-2 of the current set and 4-6 of the other, IX at 3 and IY at 7
+	int current = CPU_CORE(Alternate) ? 4 : 0;
+	int other = current ^ 4;
+	const CData* high = CPU_CORE(i_reg__DOT__RegsH);
+	const CData* low = CPU_CORE(i_reg__DOT__RegsL);
+	registers[SimGdb_AF] = CPU_CORE(ACC) << 8 | CPU_CORE(F);
+	registers[SimGdb_BC] = high[current] << 8 | low[current];
+	registers[SimGdb_DE] = high[current + 1] << 8 | low[current + 1];
+	registers[SimGdb_HL] = high[current + 2] << 8 | low[current + 2];
+	registers[SimGdb_SP] = CPU_CORE(SP);
+	registers[SimGdb_PC] = CPU_CORE(PC);
+	registers[SimGdb_IX] = high[3] << 8 | low[3];
+	registers[SimGdb_IY] = high[7] << 8 | low[7];
+	registers[SimGdb_AF2] = CPU_CORE(Ap) << 8 | CPU_CORE(Fp);
+	registers[SimGdb_BC2] = high[other] << 8 | low[other];
+	registers[SimGdb_DE2] = high[other + 1] << 8 | low[other + 1];
+	registers[SimGdb_HL2] = high[other + 2] << 8 | low[other + 2];
+	// The core is built without TV80_REFRESH, so there is no R
+	registers[SimGdb_IR] = CPU_CORE(I) << 8;
+}
+
+// Cartridge ROM seen at 4000-BFFF for the current cartridge_select
+const CData* cartridgeMemory()
+{
+	switch (top->emu__DOT__cartridge_select) {
+	case 1: return top->emu__DOT__system__DOT__cart_advbigng__DOT__mem;
+	case 2: return top->emu__DOT__system__DOT__cart_advdefnc__DOT__mem;
+	case 3: return top->emu__DOT__system__DOT__cart_bbuilder__DOT__mem;
+	case 4: return top->emu__DOT__system__DOT__cart_convent1__DOT__mem;
+	case 5: return top->emu__DOT__system__DOT__cart_cplay1__DOT__mem;
+	case 6: return top->emu__DOT__system__DOT__cart_cplay2__DOT__mem;
+	case 7: return top->emu__DOT__system__DOT__cart_cplay3__DOT__mem;
+	case 8: return top->emu__DOT__system__DOT__cart_duplict1__DOT__mem;
+	case 9: return top->emu__DOT__system__DOT__cart_mplay1__DOT__mem;
+	default: return top->emu__DOT__system__DOT__custom_cart__DOT__mem;
+	}
+}
+
+// CPU memory map: BIOS 0000-3FFF, cartridge 4000-BFFF, nothing at C000-DFFF, 8K RAM E000-FFFF
+uint8_t gdbReadMemory(uint16_t address)
+{
+	if (address < 0x4000) { return top->emu__DOT__system__DOT__pgrom__DOT__mem[address]; }
+	if (address < 0xC000) { return cartridgeMemory()[address - 0x4000]; }
+	if (address < 0xE000) { return 0; }
+	return top->emu__DOT__system__DOT__ram__DOT__mem[address & 0x1FFF];
+}
+
+bool gdbWriteMemory(uint16_t address, uint8_t value)
+{
+	if (address < 0xE000) { return false; }
+	top->emu__DOT__system__DOT__ram__DOT__mem[address & 0x1FFF] = value;
+	return true;
+}
+
+void gdbRun(bool run)
+{
+	run_enable = run;
+}
+
+bool gdbRunning()
+{
+	return run_enable;
+}
+
+// Stops land on the rising fetch strobe, the previous instruction's register writes complete by T3 of that M1
+void gdbSettle()
+{
+	for (int i = 0; i < 256; i++) {
+		if ((top->emu__DOT__system__DOT__cpu__DOT__mcycle & 1) && (top->emu__DOT__system__DOT__cpu__DOT__tstate & 8)) { return; }
+		verilate();
+	}
+}
+#undef CPU_CORE
+
+SimGdb gdb(&breakpoints, { gdbRegisters, gdbReadMemory, gdbWriteMemory, gdbRun, gdbRunning, gdbSettle });
+
+int runHeadless()
+{
+	if (video.InitialiseHeadless() != 0) { return 1; }
+	printf("Running headless%s\n", headless_frames > 0 ? fmt::format(" for {} frames", headless_frames).c_str() : "");
+
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	top->inputs = 0;
+	while ((headless_frames <= 0 || video.count_frame < headless_frames) && !input_script.quit_requested) {
+		// Only a GDB stop pauses a headless run
+		if (gdb.Connected() && !run_enable) {
+			gdb.Poll();
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+			continue;
+		}
+		breakpoints.hit = false;
+		for (int step = 0; step < batchSize; step++) {
+			verilate();
+			if ((headless_frames > 0 && video.count_frame >= headless_frames) || input_script.quit_requested) { break; }
+			if (breakpoints.hit && gdb.Connected()) { break; }
+		}
+		if (divergence_pending) { replayDivergence(); }
+		gdb.Poll();
+#ifndef DISABLE_AUDIO
+		audio.Process();
+#endif
+		metrics.Update(main_time, eval_count, video.count_frame);
+	}
+	double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+	double mhz = elapsed > 0 ? (main_time / elapsed) / 1000000.0 : 0;
+	printf("%d frames, %llu cycles in %.2fs (%.3f MHz, %.1f%% of real-time, %.1f FPS)\n", video.count_frame, (unsigned long long)main_time, elapsed, mhz, (mhz * 100000000.0) / clk_sys_freq, elapsed > 0 ? video.count_frame / elapsed : 0);
+	printf("Video timing errors: %u\n", video_timing.Errors());
+
+#ifndef DISABLE_AUDIO
+	audio.CleanUp();
+#endif
+	input_movie.StopRecording();
+	console.CloseLogFile();
+	if (profile_export_name) { profiler.ExportCSV(profile_export_name); }
+	if (timing_export_name) { timing.ExportCSV(timing_export_name); }
+	gdb.Close();
+	frame_export.Close();
+	top->final();
+	delete top;
+	return 0;
+}
+
 int main(int argc, char** argv, char** env)
 {
 	// Create core and initialise
 	top = new Vemu();
 	Verilated::commandArgs(argc, argv);
 
+	for (int i = 1; i < argc; i++) {
+		std::string arg = argv[i];
+		if (arg == "--headless") { headless = true; }
+		else if (arg == "--frames" && i + 1 < argc) { headless_frames = atoi(argv[++i]); }
+		else if (arg == "--input-script" && i + 1 < argc) { input_script_name = argv[++i]; }
+		else if (arg == "--record-movie" && i + 1 < argc) { input_movie_record_name = argv[++i]; }
+		else if (arg == "--play-movie" && i + 1 < argc) { input_movie_play_name = argv[++i]; }
+		else if (arg == "--log-file" && i + 1 < argc) { log_file_name = argv[++i]; }
+		else if (arg == "--log-compress") { log_file_compress = true; }
+		else if (arg == "--export-frames") { frame_export_name = (i + 1 < argc && argv[i + 1][0] != '-') ? argv[++i] : frame_export_default; }
+		else if (arg == "--checkpoint-interval" && i + 1 < argc) { checkpoints.interval = strtoull(argv[++i], NULL, 0); }
+		else if (arg == "--profile" && i + 1 < argc) { profile_export_name = argv[++i]; }
+		else if (arg == "--timing" && i + 1 < argc) { timing_export_name = argv[++i]; }
+		else if (arg == "--trace-file" && i + 1 < argc) { tracefilename = argv[++i]; }
+		else if (arg == "--gdb") { gdb_port = (i + 1 < argc && argv[i + 1][0] != '-') ? atoi(argv[++i]) : 1234; }
+		else if (arg == "--cpu-trace") { cpu_trace_start = (i + 1 < argc && argv[i + 1][0] != '-') ? strtoull(argv[++i], NULL, 0) : 0; }
+		else if (arg == "--convert-mame-trace" && i + 2 < argc) {
+			// Offline conversion of a MAME trace to the binary format, no simulation
+			const char* input = argv[++i];
+			const char* output = argv[++i];
+			return SimTraceFile::ConvertMame(input, output) ? 0 : 1;
+		}
+	}
+
 #ifdef WIN32
 	// Attach debug console to the verilated code
 	//Verilated::console = console;
 	Verilated::setDebug(&console);
 #endif
 
-#ifdef CPU_DEBUG
-	// Load debug opcodes
-	loadOpcodes();
-
-	// Load debug trace
-	std::string line;
-	std::ifstream fin(tracefilename);
-	while (getline(fin, line)) {
-		log_mame.push_back(line);
-	}
-#endif
+	// CPU tracing, the VCD used by divergence replay needs traceEverOn before the first eval
+	Verilated::traceEverOn(true);
+	console.AddCommand("TRACE", traceCommand);
+	console.AddCommand("BREAK", breakCommand);
+	if (cpu_trace_start != ~(vluint64_t)0) { startCpuTrace(cpu_trace_start); }
+	profiler.enabled = profile_export_name != NULL;
+	profiler.disassemble = disassembleCached;
+	disasm_cache.ram = top->emu__DOT__system__DOT__ram__DOT__mem;
+	updateDisasmCache();
+	timing.enabled = timing_export_name != NULL;
+	updateCpuHooks();
 
 	// Attach bus
 	bus.ioctl_addr = &top->ioctl_addr;
@@ -526,6 +887,7 @@ int main(int argc, char** argv, char** env)
 	bus.ioctl_dout = &top->ioctl_dout;
 	//bus.ioctl_din = &top->ioctl_din;
 	//input.ps2_key = &top->ps2_key;
+	input_0.sim_time = &main_time;
 
 #ifndef DISABLE_AUDIO
 	audio.Initialise();
@@ -566,6 +928,25 @@ int main(int argc, char** argv, char** env)
 
 #endif
 
+	if (log_file_name && !console.OpenLogFile(log_file_name, log_file_rotate_bytes, log_file_keep, log_file_compress, log_file_window)) { return 1; }
+
+	// Button names for input scripts
+	input_script.SetButtonName(input_pass, "pass");
+	input_script.SetButtonName(input_spades, "spades");
+	input_script.SetButtonName(input_clubs, "clubs");
+	input_script.SetButtonName(input_rdbl, "rdbl");
+	input_script.SetButtonName(input_NT, "nt");
+	input_script.SetButtonName(input_hearts_up, "hearts");
+	input_script.SetButtonName(input_play_yes, "yes");
+	input_script.SetButtonName(input_back, "back");
+	input_script.SetButtonName(input_dbl, "dbl");
+	input_script.SetButtonName(input_diamonds_down, "diamonds");
+	input_script.SetButtonName(input_start, "start");
+	input_script.SetButtonName(input_play_no, "no");
+	if (input_script_name && !input_script.Load(input_script_name)) { return 1; }
+	if (input_movie_play_name && !input_script.LoadMovie(input_movie_play_name)) { return 1; }
+	if (input_movie_record_name && !input_movie.StartRecording(input_movie_record_name, input_0.inputCount)) { return 1; }
+
 	// Stage ROMs
 	/*bus.LoadMRA("../releases/" + mraFilename);*/
 	//bus.QueueDownload("roms\\boot.rom", 0, false);
@@ -576,7 +957,17 @@ int main(int argc, char** argv, char** env)
 	bus.QueueDownload("roms\\bbuilder.bin", 1, true);
 
 	// Setup video output
+	video.SetPalette(vdp_palette, 16);
+	if (frame_export_name && frame_export.Open(frame_export_name, VGA_WIDTH, VGA_HEIGHT, VGA_BPP, video.output_palette, frame_export_slots)) {
+		video.frame_export = &frame_export;
+	}
+	if (gdb_port && !gdb.Listen(gdb_port)) { return 1; }
+	if (headless) { return runHeadless(); }
 	if (video.Initialise(windowTitle) == 1) { return 1; }
+#ifndef DISABLE_AUDIO
+	audio.StartPlayback();
+#endif
+	ImPlot::CreateContext();
 
 #ifdef WIN32
 	MSG msg;
@@ -601,140 +992,191 @@ int main(int argc, char** argv, char** env)
 				done = true;
 		}
 #endif
-		video.StartFrame();
-
 		input_0.Read();
 
-		// Draw GUI
-		// --------
-		ImGui::NewFrame();
-
-		// Simulation control window
-		ImGui::Begin(windowTitle_Control);
-		ImGui::SetWindowPos(windowTitle_Control, ImVec2(0, 0), ImGuiCond_Once);
-		ImGui::SetWindowSize(windowTitle_Control, ImVec2(500, 170), ImGuiCond_Once);
-		if (ImGui::Button("Reset simulation")) { resetSim(); } ImGui::SameLine();
-		if (ImGui::Button("Start running")) { run_enable = 1; } ImGui::SameLine();
-		if (ImGui::Button("Stop running")) { run_enable = 0; } ImGui::SameLine();
-		ImGui::Checkbox("RUN", &run_enable);
-		//ImGui::PopItemWidth();
-		ImGui::SliderInt("Run batch size", &batchSize, 1, 250000);
-		if (single_step == 1) { single_step = 0; }
-		if (ImGui::Button("Single Step")) { run_enable = 0; single_step = 1; }
-		ImGui::SameLine();
-		if (multi_step == 1) { multi_step = 0; }
-		if (ImGui::Button("Multi Step")) { run_enable = 0; multi_step = 1; }
-		//ImGui::SameLine();
-		ImGui::SliderInt("Multi step amount", &multi_step_amount, 8, 1024);
-
-#ifdef CPU_DEBUG
-		ImGui::NewLine();
-		ImGui::Checkbox("Log CPU instructions", &log_instructions);
-		ImGui::Checkbox("Stop on MAME diff", &stop_on_log_mismatch);
-#endif
-		ImGui::End();
+		// Only rebuild the GUI at the refresh cap, the simulation runs on every pass
+		std::chrono::steady_clock::time_point gui_now = std::chrono::steady_clock::now();
+		bool draw_gui = gui_refresh_rate <= 0 || std::chrono::duration<double>(gui_now - gui_last).count() >= 1.0 / gui_refresh_rate;
+		if (draw_gui) {
+			gui_last = gui_now;
+			metrics.BeginGuiFrame();
+			video.StartFrame();
+
+			// Draw GUI
+			// --------
+			ImGui::NewFrame();
+
+			// Simulation control window
+			ImGui::SetNextWindowPos(ImVec2(0, 0), ImGuiCond_Once);
+			ImGui::SetNextWindowSize(ImVec2(500, 170), ImGuiCond_Once);
+			if (ImGui::Begin(windowTitle_Control)) {
+				if (ImGui::Button("Reset simulation")) { resetSim(); } ImGui::SameLine();
+				if (ImGui::Button("Start running")) { run_enable = 1; } ImGui::SameLine();
+				if (ImGui::Button("Stop running")) { run_enable = 0; } ImGui::SameLine();
+				ImGui::Checkbox("RUN", &run_enable);
+				//ImGui::PopItemWidth();
+				ImGui::SliderInt("Run batch size", &batchSize, 1, 250000);
+				if (ImGui::Button("Single Step")) { run_enable = 0; single_step = 1; }
+				ImGui::SameLine();
+				if (ImGui::Button("Multi Step")) { run_enable = 0; multi_step = 1; }
+				//ImGui::SameLine();
+				ImGui::SliderInt("Multi step amount", &multi_step_amount, 8, 1024);
+				ImGui::SliderInt("GUI refresh cap (Hz)", &gui_refresh_rate, 0, 144, gui_refresh_rate == 0 ? "off" : "%d");
+				if (input_movie.recording) { ImGui::Text("Recording input movie: %u changes", input_movie.changes); }
+				if (input_script.active) { ImGui::Text("Input playback: %d/%d events", (int)input_script.next, (int)input_script.events.size()); }
+
+				ImGui::NewLine();
+				bool cpu_trace = main_time >= cpu_trace_from;
+				if (ImGui::Checkbox("Trace CPU", &cpu_trace)) {
+					if (cpu_trace) { startCpuTrace(main_time); }
+					else { stopCpuTrace(); }
+				}
+				if (cpu_trace_from != ~(vluint64_t)0 && !cpu_trace) { ImGui::SameLine(); ImGui::Text("from cycle %llu", (unsigned long long)cpu_trace_from); }
+				ImGui::Checkbox("Log CPU instructions", &log_instructions);
+				ImGui::Checkbox("Stop on MAME diff", &stop_on_log_mismatch);
+				ImGui::Text("Checkpoints: %d (%.1f MB)", checkpoints.Count(), checkpoints.Bytes() / (1024.0 * 1024.0));
+			}
+			ImGui::End();
 
-		ImGui::Begin("LOADER");
-		if (ImGui::Button("Alpha!?")) {
-			top->emu__DOT__cartridge_select = 0;
-			bus.QueueDownload("roms\\alpha.bin", 1, true);
-		}
-		if (ImGui::Button("Burger!?")) {
-			top->emu__DOT__cartridge_select = 0;
-			bus.QueueDownload("roms\\burger.bin", 1, true);
-		}
+			if (ImGui::Begin("LOADER")) {
+				if (ImGui::Button("Alpha!?")) {
+					top->emu__DOT__cartridge_select = 0;
+					bus.QueueDownload("roms\\alpha.bin", 1, true);
+				}
+				if (ImGui::Button("Burger!?")) {
+					top->emu__DOT__cartridge_select = 0;
+					bus.QueueDownload("roms\\burger.bin", 1, true);
+				}
 
-		if (ImGui::Button("Advanced Bidding")) { top->emu__DOT__cartridge_select = 1; }
-		if (ImGui::Button("Advanced Defence")) { top->emu__DOT__cartridge_select = 2; }
-		if (ImGui::Button("Bridge Builder")) { top->emu__DOT__cartridge_select = 3; }
-
-		ImGui::End();
-
-		// Debug log window
-		console.Draw(windowTitle_DebugLog, &showDebugLog, ImVec2(500, 700));
-		ImGui::SetWindowPos(windowTitle_DebugLog, ImVec2(0, 160), ImGuiCond_Once);
-
-		// Memory debug
-		//ImGui::Begin("PGROM");
-		//mem_edit_8.DrawContents(&top->emu__DOT__system__DOT__pgrom__DOT__mem, 32768, 0);
-		//ImGui::End(); 
-		ImGui::Begin("RAM");
-		mem_edit_16.DrawContents(&top->emu__DOT__system__DOT__ram__DOT__mem, 4096, 0);
-		ImGui::End();
-		//ImGui::Begin("VRAM");
-		//mem_edit_16.DrawContents(&top->emu__DOT__system__DOT__vram__DOT__mem, 16384, 0);
-		//ImGui::End();
-		//ImGui::Begin("CUSTOM_CART");
-		//mem_edit_16.DrawContents(&top->emu__DOT__system__DOT__custom_cart__DOT__mem, 32768, 0);
-		//ImGui::End();
-
-		int windowX = 550;
-		int windowWidth = (VGA_WIDTH * VGA_SCALE_X) + 24;
-		int windowHeight = (VGA_HEIGHT * VGA_SCALE_Y) + 90;
-
-		// Video window
-		ImGui::Begin(windowTitle_Video);
-		ImGui::SetWindowPos(windowTitle_Video, ImVec2(windowX, 0), ImGuiCond_Once);
-		ImGui::SetWindowSize(windowTitle_Video, ImVec2(windowWidth, windowHeight), ImGuiCond_Once);
-
-		ImGui::SetNextItemWidth(400);
-		ImGui::SliderFloat("Zoom", &vga_scale, 1, 8); ImGui::SameLine();
-		ImGui::SetNextItemWidth(200);
-		ImGui::SliderInt("Rotate", &video.output_rotate, -1, 1); ImGui::SameLine();
-		ImGui::Checkbox("Flip V", &video.output_vflip);
-		ImGui::Text("main_time: %d frame_count: %d sim FPS: %f", main_time, video.count_frame, video.stats_fps);
-
-		// Draw VGA output
-		ImGui::Image(video.texture_id, ImVec2(video.output_width * VGA_SCALE_X, video.output_height * VGA_SCALE_Y));
-		ImGui::End();
+				if (ImGui::Button("Advanced Bidding")) { top->emu__DOT__cartridge_select = 1; }
+				if (ImGui::Button("Advanced Defence")) { top->emu__DOT__cartridge_select = 2; }
+				if (ImGui::Button("Bridge Builder")) { top->emu__DOT__cartridge_select = 3; }
+			}
+			ImGui::End();
+
+			// Debug log window
+			console.Draw(windowTitle_DebugLog, &showDebugLog, ImVec2(500, 700));
+			ImGui::SetWindowPos(windowTitle_DebugLog, ImVec2(0, 160), ImGuiCond_Once);
+
+			// Memory debug
+			//ImGui::Begin("PGROM");
+			//mem_edit_8.DrawContents(&top->emu__DOT__system__DOT__pgrom__DOT__mem, 32768, 0);
+			//ImGui::End(); 
+			if (ImGui::Begin("RAM")) {
+				mem_edit_16.DrawContents(&top->emu__DOT__system__DOT__ram__DOT__mem, 4096, 0);
+			}
+			ImGui::End();
+			//ImGui::Begin("VRAM");
+			//mem_edit_16.DrawContents(&top->emu__DOT__system__DOT__vram__DOT__mem, 16384, 0);
+			//ImGui::End();
+			//ImGui::Begin("CUSTOM_CART");
+			//mem_edit_16.DrawContents(&top->emu__DOT__system__DOT__custom_cart__DOT__mem, 32768, 0);
+			//ImGui::End();
+
+			int windowX = 550;
+			int windowWidth = (VGA_WIDTH * VGA_SCALE_X) + 24;
+			int windowHeight = (VGA_HEIGHT * VGA_SCALE_Y) + 90;
+
+			// Video window
+			ImGui::Begin(windowTitle_Video);
+			ImGui::SetWindowPos(windowTitle_Video, ImVec2(windowX, 0), ImGuiCond_Once);
+			ImGui::SetWindowSize(windowTitle_Video, ImVec2(windowWidth, windowHeight), ImGuiCond_Once);
+
+			ImGui::SetNextItemWidth(400);
+			ImGui::SliderFloat("Zoom", &vga_scale, 1, 8); ImGui::SameLine();
+			ImGui::SetNextItemWidth(200);
+			ImGui::SliderInt("Rotate", &video.output_rotate, -1, 1); ImGui::SameLine();
+			ImGui::Checkbox("Flip V", &video.output_vflip);
+			ImGui::Text("main_time: %d frame_count: %d sim FPS: %f", main_time, video.count_frame, video.stats_fps);
+
+			// Draw VGA output
+			ImGui::Image(video.texture_id, ImVec2(video.output_width * VGA_SCALE_X, video.output_height * VGA_SCALE_Y));
+			ImGui::End();
+
+			// Performance metrics window
+			ImGui::SetNextWindowPos(ImVec2(windowX + windowWidth, 0), ImGuiCond_Once);
+			metrics.Draw(windowTitle_Metrics, &showMetrics, ImVec2(420, 460));
+
+			// Video timing analyser window
+			ImGui::SetNextWindowPos(ImVec2(windowX + windowWidth, 460), ImGuiCond_Once);
+			video_timing.Draw(windowTitle_VideoTiming, &showVideoTiming, ImVec2(520, 160));
+			profiler.Draw(windowTitle_Profiler, &showProfiler, ImVec2(640, 480));
+			timing.Draw(windowTitle_Timing, &showTiming, ImVec2(640, 400));
+			updateDisasmCache();
+			disasm_cache.Draw(windowTitle_Disassembly, &showDisassembly, ImVec2(420, 600), top->emu__DOT__system__DOT__cpu__DOT__i_tv80_core__DOT__PC);
+			breakpoints.Draw(windowTitle_Breakpoints, &showBreakpoints, ImVec2(320, 300));
+			updateCpuHooks();
 
 
 #ifndef DISABLE_AUDIO
 
-		ImGui::Begin(windowTitle_Audio);
-		ImGui::SetWindowPos(windowTitle_Audio, ImVec2(windowX, windowHeight), ImGuiCond_Once);
-		ImGui::SetWindowSize(windowTitle_Audio, ImVec2(windowWidth, 250), ImGuiCond_Once);
-		if (run_enable) {
-			audio.CollectDebug((signed short)top->AUDIO_L, (signed short)top->AUDIO_R);
-		}
-		int channelWidth = (windowWidth / 2) - 16;
-		ImPlot::CreateContext();
-		if (ImPlot::BeginPlot("Audio - L", ImVec2(channelWidth, 220), ImPlotFlags_NoLegend | ImPlotFlags_NoMenus | ImPlotFlags_NoTitle)) {
-			ImPlot::SetupAxes("T", "A", ImPlotAxisFlags_NoLabel | ImPlotAxisFlags_NoTickMarks, ImPlotAxisFlags_AutoFit | ImPlotAxisFlags_NoLabel | ImPlotAxisFlags_NoTickMarks);
-			ImPlot::SetupAxesLimits(0, 1, -1, 1, ImPlotCond_Once);
-			ImPlot::PlotStairs("", audio.debug_positions, audio.debug_wave_l, audio.debug_max_samples, audio.debug_pos);
-			ImPlot::EndPlot();
-		}
-		ImGui::SameLine();
-		if (ImPlot::BeginPlot("Audio - R", ImVec2(channelWidth, 220), ImPlotFlags_NoLegend | ImPlotFlags_NoMenus | ImPlotFlags_NoTitle)) {
-			ImPlot::SetupAxes("T", "A", ImPlotAxisFlags_NoLabel | ImPlotAxisFlags_NoTickMarks, ImPlotAxisFlags_AutoFit | ImPlotAxisFlags_NoLabel | ImPlotAxisFlags_NoTickMarks);
-			ImPlot::SetupAxesLimits(0, 1, -1, 1, ImPlotCond_Once);
-			ImPlot::PlotStairs("", audio.debug_positions, audio.debug_wave_r, audio.debug_max_samples, audio.debug_pos);
-			ImPlot::EndPlot();
-		}
-		ImPlot::DestroyContext();
-		ImGui::End();
+			ImGui::SetNextWindowPos(ImVec2(windowX, windowHeight), ImGuiCond_Once);
+			ImGui::SetNextWindowSize(ImVec2(windowWidth, 250), ImGuiCond_Once);
+			if (ImGui::Begin(windowTitle_Audio)) {
+				if (run_enable) {
+					audio.CollectDebug((signed short)top->AUDIO_L, (signed short)top->AUDIO_R);
+				}
+				ImGui::Text("Playback buffer: %.0f%%  underruns: %u  overruns: %u", audio.PlaybackFill() * 100.0f, audio.PlaybackUnderruns(), audio.PlaybackOverruns());
+				ImGui::SameLine();
+				ImGui::Checkbox("Pace to audio", &audio_pacing);
+				int channelWidth = (windowWidth / 2) - 16;
+				if (ImPlot::BeginPlot("Audio - L", ImVec2(channelWidth, 220), ImPlotFlags_NoLegend | ImPlotFlags_NoMenus | ImPlotFlags_NoTitle)) {
+					ImPlot::SetupAxes("T", "A", ImPlotAxisFlags_NoLabel | ImPlotAxisFlags_NoTickMarks, ImPlotAxisFlags_AutoFit | ImPlotAxisFlags_NoLabel | ImPlotAxisFlags_NoTickMarks);
+					ImPlot::SetupAxesLimits(0, 1, -1, 1, ImPlotCond_Once);
+					ImPlot::PlotStairs("", audio.debug_positions, audio.debug_wave_l, audio.debug_max_samples, audio.debug_pos);
+					ImPlot::EndPlot();
+				}
+				ImGui::SameLine();
+				if (ImPlot::BeginPlot("Audio - R", ImVec2(channelWidth, 220), ImPlotFlags_NoLegend | ImPlotFlags_NoMenus | ImPlotFlags_NoTitle)) {
+					ImPlot::SetupAxes("T", "A", ImPlotAxisFlags_NoLabel | ImPlotAxisFlags_NoTickMarks, ImPlotAxisFlags_AutoFit | ImPlotAxisFlags_NoLabel | ImPlotAxisFlags_NoTickMarks);
+					ImPlot::SetupAxesLimits(0, 1, -1, 1, ImPlotCond_Once);
+					ImPlot::PlotStairs("", audio.debug_positions, audio.debug_wave_r, audio.debug_max_samples, audio.debug_pos);
+					ImPlot::EndPlot();
+				}
+			}
+			ImGui::End();
 #endif
 
-		video.UpdateTexture();
+			video.UpdateTexture();
+			metrics.EndGuiFrame();
+		}
 
-		// Pass inputs to sim
-		top->inputs = 0;
-		for (int i = 0; i < input_0.inputCount; i++)
-		{
-			if (input_0.inputs[i]) { top->inputs |= (1 << i); }
+		// Pass inputs to sim, a loaded input script drives them from verilate() instead
+		if (!input_script.active) {
+			top->inputs = 0;
+			for (int i = 0; i < input_0.inputCount; i++)
+			{
+				if (input_0.inputs[i]) { top->inputs |= (1 << i); }
+			}
+			input_movie.Record(main_time, top->inputs);
 		}
 
 		// Run simulation
-		if (run_enable) {
-			for (int step = 0; step < batchSize; step++) { verilate(); }
+		bool run_batch = run_enable;
+#ifndef DISABLE_AUDIO
+		// Playback is far enough ahead, let it drain rather than outrun real time
+		if (run_batch && audio_pacing && audio.PlaybackFill() > audio_high_water) { run_batch = false; }
+#endif
+		if (run_batch || single_step || multi_step) { breakpoints.hit = false; }
+		if (run_batch) {
+			for (int step = 0; step < batchSize && !breakpoints.hit; step++) { verilate(); }
 		}
 		else {
 			if (single_step) { verilate(); }
 			if (multi_step) {
-				for (int step = 0; step < multi_step_amount; step++) { verilate(); }
+				for (int step = 0; step < multi_step_amount && !breakpoints.hit; step++) { verilate(); }
 			}
+			// Avoid spinning while idle between GUI refreshes
+			if (!draw_gui && !single_step && !multi_step) { std::this_thread::sleep_for(std::chrono::milliseconds(1)); }
 		}
+		single_step = 0;
+		multi_step = 0;
+		if (divergence_pending) { replayDivergence(); }
+		gdb.Poll();
+#ifndef DISABLE_AUDIO
+		audio.Process();
+#endif
+		metrics.Update(main_time, eval_count, video.count_frame);
 	}
 
 	// Clean up before exit
@@ -743,6 +1185,12 @@ int main(int argc, char** argv, char** env)
 #ifndef DISABLE_AUDIO
 	audio.CleanUp();
 #endif
+	input_movie.StopRecording();
+	console.CloseLogFile();
+	if (profile_export_name) { profiler.ExportCSV(profile_export_name); }
+	if (timing_export_name) { timing.ExportCSV(timing_export_name); }
+	gdb.Close();
+	ImPlot::DestroyContext();
 	video.CleanUp();
 	input_0.CleanUp();
 
@@ -1,4 +1,4 @@
-export OPTIMIZE="-O3 --x-assign fast --x-initial fast --noassert"
+export OPTIMIZE="-O3 --x-assign fast --x-initial fast --noassert --savable"
 export WARNINGS="-Wno-fatal -Wno-LITENDIAN"
 
 set -e
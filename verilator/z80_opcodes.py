@@ -0,0 +1,176 @@
+#!/usr/bin/env python3
+# Generates sim/sim_z80_opcodes.h from z80_opcodes.csv
+# Each mnemonic is split at its operand placeholders so the tracer only has to copy text and hex digits:
+#   &0000  16-bit immediate
+#   &00    8-bit immediate (first use takes the first operand byte, second use the next)
+#   &4546  relative jump target (pc + displacement + 2 for djnz/jr, otherwise pc + 2)
+# Documented T-states come from the timing rules below, not the CSV.
+# Usage: python3 z80_opcodes.py [z80_opcodes.csv] [sim/sim_z80_opcodes.h]
+
+import csv
+import sys
+
+source = sys.argv[1] if len(sys.argv) > 1 else 'z80_opcodes.csv'
+target = sys.argv[2] if len(sys.argv) > 2 else 'sim/sim_z80_opcodes.h'
+
+tables = [
+	('base', ''),
+	('cb', 'cb'),
+	('ed', 'ed'),
+	('dd', 'dd'),
+	('fd', 'fd'),
+	('ddcb', 'ddcb'),
+	('fdcb', 'fdcb'),
+]
+placeholders = [('&0000', 'SimZ80_OperandWord'), ('&4546', None), ('&00', 'SimZ80_OperandByte')]
+
+
+def parse(text):
+	parts = []
+	operands = []
+	rest = text
+	while True:
+		found = None
+		for token, kind in placeholders:
+			pos = rest.find(token)
+			if pos >= 0 and (found is None or pos < found[0]):
+				found = (pos, token, kind)
+		if found is None or len(operands) == 2:
+			break
+		pos, token, kind = found
+		if kind is None:
+			kind = 'SimZ80_OperandJump' if text.startswith('djnz') or text.startswith('jr  ') else 'SimZ80_OperandNext'
+		parts.append(rest[:pos])
+		operands.append(kind)
+		rest = rest[pos + len(token):]
+	parts.append(rest)
+	while len(parts) < 3:
+		parts.append('')
+		operands.append('SimZ80_OperandNone')
+	return parts, operands[:2]
+
+
+# Documented T-states, (cycles, cycles when a condition is met or a block instruction repeats); 0 = undocumented
+def base_timing(op):
+	rows = [
+		4, 10, 7, 6, 4, 4, 7, 4, 4, 11, 7, 6, 4, 4, 7, 4,
+		8, 10, 7, 6, 4, 4, 7, 4, 12, 11, 7, 6, 4, 4, 7, 4,
+		7, 10, 16, 6, 4, 4, 7, 4, 7, 11, 16, 6, 4, 4, 7, 4,
+		7, 10, 13, 6, 11, 11, 10, 4, 7, 11, 13, 6, 4, 4, 7, 4,
+	]
+	alt = { 0x10: 13, 0x20: 12, 0x28: 12, 0x30: 12, 0x38: 12 }
+	if op < 0x40:
+		return rows[op], alt.get(op, 0)
+	if op < 0xC0:
+		if op == 0x76:
+			return 4, 0
+		memory = (op & 7) == 6 or (0x70 <= op <= 0x77)
+		return (7 if memory else 4), 0
+	column = op & 7
+	if column == 0:
+		return 5, 11		# ret cc
+	if column == 2:
+		return 10, 0		# jp cc
+	if column == 4:
+		return 10, 17		# call cc
+	if column == 6:
+		return 7, 0			# alu n
+	if column == 7:
+		return 11, 0		# rst
+	other = {
+		0xC1: 10, 0xC3: 10, 0xC5: 11, 0xC9: 10, 0xCB: 0, 0xCD: 17,
+		0xD1: 10, 0xD3: 11, 0xD5: 11, 0xD9: 4, 0xDB: 11, 0xDD: 0,
+		0xE1: 10, 0xE3: 19, 0xE5: 11, 0xE9: 4, 0xEB: 4, 0xED: 0,
+		0xF1: 10, 0xF3: 4, 0xF5: 11, 0xF9: 6, 0xFB: 4, 0xFD: 0,
+	}
+	return other[op], 0
+
+
+def cb_timing(op):
+	memory = (op & 7) == 6
+	if 0x40 <= op < 0x80:
+		return (12 if memory else 8), 0		# bit
+	return (15 if memory else 8), 0
+
+
+def ed_timing(op):
+	if 0x40 <= op < 0x80:
+		column = op & 7
+		if column == 7:
+			return (18 if op in (0x67, 0x6F) else 9 if op < 0x60 else 0), 0
+		return [12, 12, 15, 20, 8, 14, 8][column], 0
+	if 0xA0 <= op < 0xC0 and (op & 7) < 4 and (op & 0x10) == 0:
+		return 16, 0
+	if 0xA0 <= op < 0xC0 and (op & 7) < 4:
+		return 16, 21
+	return 0, 0
+
+
+def index_timing(op):
+	if op in (0x34, 0x35, 0xE3):
+		return 23, 0
+	if op == 0x36 or (op in range(0x40, 0xC0) and op != 0x76 and ((op & 7) == 6 or 0x70 <= op <= 0x77)):
+		return 19, 0
+	if op == 0xE9:
+		return 8, 0
+	cycles, alt = base_timing(op)
+	if cycles == 0:
+		return 0, 0
+	return cycles + 4, (alt + 4 if alt else 0)
+
+
+def index_cb_timing(op):
+	return (20 if 0x40 <= op < 0x80 else 23), 0
+
+
+timings = {
+	'': base_timing,
+	'cb': cb_timing,
+	'ed': ed_timing,
+	'dd': index_timing,
+	'fd': index_timing,
+	'ddcb': index_cb_timing,
+	'fdcb': index_cb_timing,
+}
+
+
+def quote(s):
+	return '"' + s.replace('\\', '\\\\').replace('"', '\\"') + '"'
+
+
+entries = {prefix: {} for _, prefix in tables}
+with open(source, encoding='utf-8-sig', newline='') as f:
+	reader = csv.reader(f)
+	next(reader)
+	for row in reader:
+		if len(row) < 2 or not row[0].startswith('0x'):
+			continue
+		code = row[0][2:].lower()
+		prefix, op = code[:-2], int(code[-2:], 16)
+		if prefix not in entries:
+			print('%s: skipping %s, unknown prefix' % (source, row[0]))
+			continue
+		# Later rows win, matching the old std::map loader
+		entries[prefix][op] = row[1]
+
+out = []
+out.append('#pragma once')
+out.append('// Generated by z80_opcodes.py from z80_opcodes.csv - do not edit')
+out.append('#include "sim_z80_disasm.h"')
+out.append('')
+for name, prefix in tables:
+	out.append('static constexpr SimZ80_Opcode simz80_%s[256] = {' % name)
+	for op in range(256):
+		text = entries[prefix].get(op)
+		cycles, cycles_alt = timings[prefix](op)
+		if text is None:
+			out.append('\t{ { NULL, NULL, NULL }, { SimZ80_OperandNone, SimZ80_OperandNone }, false, %d, %d },' % (cycles, cycles_alt))
+			continue
+		parts, operands = parse(text)
+		is_prefix = text.startswith('****')
+		out.append('\t{ { %s }, { %s }, %s, %d, %d },\t// %02x %s' % (', '.join(quote(p) for p in parts), ', '.join(operands), 'true' if is_prefix else 'false', cycles, cycles_alt, op, text))
+	out.append('};')
+	out.append('')
+
+with open(target, 'w', newline='\n') as f:
+	f.write('\n'.join(out))